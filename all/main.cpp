@@ -0,0 +1,181 @@
+#include "Days.hpp"
+#include "Instrumentation.hpp"
+#include "ThreadPool.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct DayRun
+	{
+		bool skipped = true;
+		std::string error;
+		std::string output;
+		std::string json;
+		std::chrono::nanoseconds start{};
+		std::chrono::nanoseconds end{};
+	};
+
+	struct RunnerOptions
+	{
+		HarnessOptions harness;
+		std::size_t jobs = std::thread::hardware_concurrency();
+	};
+
+	// Accepts: [--jobs N] [--warmup N] [--iterations N] [--cold] [--perf] [--json PATH] [--threads N] INPUT_DIR
+	// --jobs runs that many days at once, --threads sizes the pool the days share for their own parallelism.
+	RunnerOptions ParseRunnerOptions(int argc, char **argv)
+	{
+		RunnerOptions options{};
+		options.harness = ParseHarnessOptions(argc, argv);
+		if (options.harness.jobs != 0)
+		{
+			options.jobs = options.harness.jobs;
+		}
+		return options;
+	}
+
+	double Milliseconds(std::chrono::nanoseconds value)
+	{
+		return static_cast<double>(value.count()) / 1e6;
+	}
+
+	void RunDay(const Day &day, HarnessOptions options, Clock::time_point epoch, DayRun &run)
+	{
+		run.skipped = false;
+		run.start = Clock::now() - epoch;
+		try
+		{
+			Harness harness{std::string{day.name}, std::move(options)};
+			day.registration(harness);
+			harness.Run();
+
+			std::ostringstream output;
+			harness.PrintResults(output);
+			harness.PrintReport(output);
+			run.output = output.str();
+
+			std::ostringstream json;
+			harness.WriteJson(json);
+			run.json = json.str();
+		}
+		catch (const std::exception &e)
+		{
+			run.error = e.what();
+		}
+		run.end = Clock::now() - epoch;
+	}
+}
+
+// Runs every day that has an input in INPUT_DIR (named dayN.txt) concurrently, one pool task per day,
+// and reports the makespan next to the per-day wall times.
+int main(int argc, char **argv)
+{
+	const auto &days = AllDays();
+	const auto options = ParseRunnerOptions(argc, argv);
+	const std::filesystem::path inputDir{options.harness.inputPath};
+	SetDefaultPoolSize(options.harness.threads);
+
+	std::vector<DayRun> runs(days.size());
+	const auto epoch = Clock::now();
+	{
+		ThreadPool pool{options.jobs};
+		for (auto i = 0U; i < days.size(); ++i)
+		{
+			auto dayOptions = options.harness;
+			dayOptions.inputPath = (inputDir / (std::string{days[i].name} + ".txt")).string();
+			dayOptions.jsonPath.reset();
+			if (!std::filesystem::exists(dayOptions.inputPath))
+			{
+				continue;
+			}
+
+			pool.Submit([&day = days[i], dayOptions, epoch, &run = runs[i]]
+			            {
+				            RunDay(day, dayOptions, epoch, run);
+			            });
+		}
+		pool.Wait();
+	}
+	const auto makespan = Clock::now() - epoch;
+
+	std::chrono::nanoseconds serial{};
+	auto failed = false;
+	for (auto i = 0U; i < days.size(); ++i)
+	{
+		const auto &run = runs[i];
+		if (run.skipped)
+		{
+			continue;
+		}
+		std::cout << "== " << days[i].name << "\r\n";
+		if (!run.error.empty())
+		{
+			std::cout << "Failed: " << run.error << "\r\n";
+			failed = true;
+		}
+		std::cout << run.output << "\r\n";
+		serial += run.end - run.start;
+	}
+
+	std::cout << std::left << std::setw(8) << "Day" << std::right
+	          << std::setw(12) << "start" << std::setw(12) << "end" << std::setw(12) << "wall" << "\r\n";
+	std::cout << std::fixed << std::setprecision(1);
+	for (auto i = 0U; i < days.size(); ++i)
+	{
+		const auto &run = runs[i];
+		if (run.skipped)
+		{
+			continue;
+		}
+		std::cout << std::left << std::setw(8) << days[i].name << std::right
+		          << std::setw(10) << Milliseconds(run.start) << "ms"
+		          << std::setw(10) << Milliseconds(run.end) << "ms"
+		          << std::setw(10) << Milliseconds(run.end - run.start) << "ms" << "\r\n";
+	}
+	std::cout << "Makespan: " << Milliseconds(makespan) << "ms on " << options.jobs << " threads, "
+	          << "sum of day wall times: " << Milliseconds(serial) << "ms\r\n";
+
+	if constexpr (instrumentation::Enabled())
+	{
+		std::cout << "Instrumentation, totals over all days:\r\n";
+		instrumentation::WriteReport(std::cout);
+	}
+
+	if (const auto &jsonPath = options.harness.jsonPath; jsonPath.has_value())
+	{
+		std::ofstream file(*jsonPath);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		file << "{\n";
+		file << "  \"jobs\": " << options.jobs << ",\n";
+		file << "  \"makespan_ns\": " << std::chrono::duration_cast<std::chrono::nanoseconds>(makespan).count() << ",\n";
+		file << "  \"days\": [";
+		auto first = true;
+		for (auto i = 0U; i < days.size(); ++i)
+		{
+			const auto &run = runs[i];
+			if (run.skipped || !run.error.empty())
+			{
+				continue;
+			}
+			file << (first ? "\n" : ",\n") << "{\"start_ns\": " << run.start.count()
+			     << ", \"end_ns\": " << run.end.count() << ", \"report\": " << run.json << "}";
+			first = false;
+		}
+		file << "\n  ]\n}\n";
+	}
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+#include "Json.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+namespace
+{
+	class Parser
+	{
+	public:
+		explicit Parser(std::string_view text) : _text(text)
+		{}
+
+		JsonValue ParseDocument()
+		{
+			auto value = ParseValue();
+			SkipWhitespace();
+			if (_position != _text.size())
+			{
+				throw std::runtime_error("Trailing characters after JSON document");
+			}
+			return value;
+		}
+
+	private:
+		JsonValue ParseValue()
+		{
+			SkipWhitespace();
+			JsonValue value;
+			switch (Peek())
+			{
+				case '{':
+					value.type = JsonValue::Type::Object;
+					++_position;
+					if (!Consume('}'))
+					{
+						do
+						{
+							SkipWhitespace();
+							auto key = ParseString();
+							Expect(':');
+							value.object.emplace_back(std::move(key), ParseValue());
+						} while (Consume(','));
+						Expect('}');
+					}
+					break;
+				case '[':
+					value.type = JsonValue::Type::Array;
+					++_position;
+					if (!Consume(']'))
+					{
+						do
+						{
+							value.array.push_back(ParseValue());
+						} while (Consume(','));
+						Expect(']');
+					}
+					break;
+				case '"':
+					value.type = JsonValue::Type::String;
+					value.string = ParseString();
+					break;
+				case 't':
+					ExpectWord("true");
+					value.type = JsonValue::Type::Bool;
+					value.boolean = true;
+					break;
+				case 'f':
+					ExpectWord("false");
+					value.type = JsonValue::Type::Bool;
+					break;
+				case 'n':
+					ExpectWord("null");
+					break;
+				default:
+					value.type = JsonValue::Type::Number;
+					value.number = ParseNumber();
+					break;
+			}
+			return value;
+		}
+
+		std::string ParseString()
+		{
+			Expect('"');
+			std::string result;
+			while (Peek() != '"')
+			{
+				auto c = _text[_position++];
+				if (c == '\\')
+				{
+					c = Peek();
+					++_position;
+					switch (c)
+					{
+						case 'n':
+							c = '\n';
+							break;
+						case 'r':
+							c = '\r';
+							break;
+						case 't':
+							c = '\t';
+							break;
+						case 'u':
+						{
+							// The harness only escapes control characters this way.
+							if (_position + 4 > _text.size())
+							{
+								throw std::runtime_error("Unsupported JSON escape");
+							}
+							unsigned code = 0;
+							const auto res = std::from_chars(_text.data() + _position, _text.data() + _position + 4, code, 16);
+							if (res.ptr != _text.data() + _position + 4 || code > 0x7f)
+							{
+								throw std::runtime_error("Unsupported JSON escape");
+							}
+							_position += 4;
+							c = static_cast<char>(code);
+							break;
+						}
+						default:
+							break;
+					}
+				}
+				result.push_back(c);
+			}
+			++_position;
+			return result;
+		}
+
+		double ParseNumber()
+		{
+			double result{};
+			const auto res = std::from_chars(_text.data() + _position, _text.data() + _text.size(), result);
+			if (res.ec != std::errc())
+			{
+				throw std::runtime_error("Invalid JSON value");
+			}
+			_position = static_cast<std::size_t>(res.ptr - _text.data());
+			return result;
+		}
+
+		void SkipWhitespace()
+		{
+			while (_position < _text.size() && std::isspace(static_cast<unsigned char>(_text[_position])))
+			{
+				++_position;
+			}
+		}
+
+		char Peek() const
+		{
+			if (_position >= _text.size())
+			{
+				throw std::runtime_error("Unexpected end of JSON document");
+			}
+			return _text[_position];
+		}
+
+		bool Consume(char c)
+		{
+			SkipWhitespace();
+			if (_position < _text.size() && _text[_position] == c)
+			{
+				++_position;
+				return true;
+			}
+			return false;
+		}
+
+		void Expect(char c)
+		{
+			if (!Consume(c))
+			{
+				throw std::runtime_error(std::string{"Expected '"} + c + "' in JSON document");
+			}
+		}
+
+		void ExpectWord(std::string_view word)
+		{
+			if (_text.substr(_position, word.size()) != word)
+			{
+				throw std::runtime_error("Invalid JSON value");
+			}
+			_position += word.size();
+		}
+
+	private:
+		std::string_view _text;
+		std::size_t _position = 0;
+	};
+}
+
+const JsonValue *JsonValue::Find(std::string_view key) const
+{
+	for (const auto &[name, value]: object)
+	{
+		if (name == key)
+		{
+			return &value;
+		}
+	}
+	return nullptr;
+}
+
+const JsonValue &JsonValue::At(std::string_view key) const
+{
+	const auto *value = Find(key);
+	if (value == nullptr)
+	{
+		throw std::runtime_error("Missing JSON member " + std::string{key});
+	}
+	return *value;
+}
+
+JsonValue ParseJson(std::string_view text)
+{
+	return Parser{text}.ParseDocument();
+}
@@ -0,0 +1,38 @@
+#ifndef ADVENTOFCODE2021_JSON_HPP
+#define ADVENTOFCODE2021_JSON_HPP
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Parsed JSON document, just enough to read the reports the harness writes.
+struct JsonValue
+{
+	enum class Type
+	{
+		Null,
+		Bool,
+		Number,
+		String,
+		Array,
+		Object,
+	};
+
+	Type type = Type::Null;
+	bool boolean = false;
+	double number = 0.0;
+	std::string string;
+	std::vector<JsonValue> array;
+	// Members in document order.
+	std::vector<std::pair<std::string, JsonValue>> object;
+
+	// Null if this is not an object or has no such member.
+	[[nodiscard]] const JsonValue *Find(std::string_view key) const;
+	// Throws if the member is missing.
+	[[nodiscard]] const JsonValue &At(std::string_view key) const;
+};
+
+[[nodiscard]] JsonValue ParseJson(std::string_view text);
+
+#endif //ADVENTOFCODE2021_JSON_HPP
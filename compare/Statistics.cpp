@@ -0,0 +1,78 @@
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+double Median(std::vector<double> values)
+{
+	if (values.empty())
+	{
+		return 0.0;
+	}
+	const auto middle = values.size() / 2;
+	std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle), values.end());
+	if (values.size() % 2 == 1)
+	{
+		return values[middle];
+	}
+	const auto upper = values[middle];
+	return (*std::max_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle)) + upper) / 2.0;
+}
+
+double MannWhitneyP(const std::vector<double> &first, const std::vector<double> &second)
+{
+	const auto n1 = static_cast<double>(first.size());
+	const auto n2 = static_cast<double>(second.size());
+	if (first.size() < 3 || second.size() < 3)
+	{
+		return 1.0;
+	}
+
+	// Pairs of value and sample index, tied values share the average of their ranks.
+	std::vector<std::pair<double, int>> pooled;
+	pooled.reserve(first.size() + second.size());
+	for (const auto value: first)
+	{
+		pooled.emplace_back(value, 0);
+	}
+	for (const auto value: second)
+	{
+		pooled.emplace_back(value, 1);
+	}
+	std::sort(pooled.begin(), pooled.end());
+
+	double rankSum = 0.0;
+	double tieTerm = 0.0;
+	for (std::size_t i = 0; i < pooled.size();)
+	{
+		auto j = i;
+		while (j < pooled.size() && pooled[j].first == pooled[i].first)
+		{
+			++j;
+		}
+		const auto rank = static_cast<double>(i + j + 1) / 2.0;
+		for (auto k = i; k < j; ++k)
+		{
+			if (pooled[k].second == 0)
+			{
+				rankSum += rank;
+			}
+		}
+		const auto ties = static_cast<double>(j - i);
+		tieTerm += ties * ties * ties - ties;
+		i = j;
+	}
+
+	const auto u = rankSum - n1 * (n1 + 1.0) / 2.0;
+	const auto n = n1 + n2;
+	const auto mean = n1 * n2 / 2.0;
+	const auto variance = n1 * n2 / 12.0 * ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+	if (variance <= 0.0)
+	{
+		return 1.0;
+	}
+	// Continuity correction, the statistic is discrete.
+	const auto z = std::max(std::abs(u - mean) - 0.5, 0.0) / std::sqrt(variance);
+	return std::erfc(z / std::sqrt(2.0));
+}
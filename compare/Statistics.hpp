@@ -0,0 +1,13 @@
+#ifndef ADVENTOFCODE2021_STATISTICS_HPP
+#define ADVENTOFCODE2021_STATISTICS_HPP
+
+#include <vector>
+
+[[nodiscard]] double Median(std::vector<double> values);
+
+// Two sided Mann-Whitney U test, returns the probability that samples at least this far apart come from
+// the same distribution. Makes no normality assumption, timing samples are skewed by outliers. Uses the
+// normal approximation with tie correction, so samples of fewer than three values always give 1.
+[[nodiscard]] double MannWhitneyP(const std::vector<double> &first, const std::vector<double> &second);
+
+#endif //ADVENTOFCODE2021_STATISTICS_HPP
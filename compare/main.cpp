@@ -0,0 +1,348 @@
+#include "Json.hpp"
+#include "Statistics.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	constexpr auto DayWidth = 8;
+	constexpr auto PhaseWidth = 12;
+	constexpr auto ColumnWidth = 14;
+
+	struct CompareOptions
+	{
+		// Significance level of the Mann-Whitney test.
+		double alpha = 0.01;
+		// Smallest slowdown in percent that counts as a regression, filters out significant but tiny shifts.
+		double threshold = 5.0;
+		// Smallest slowdown of the median in nanoseconds, phases near the timer resolution are mostly noise.
+		double minDelta = 1000.0;
+		std::string baselinePath;
+		std::string currentPath;
+	};
+
+	double ParseDouble(std::string_view value)
+	{
+		double result{};
+		const auto res = std::from_chars(value.data(), value.data() + value.size(), result);
+		if (res.ec != std::errc() || res.ptr != value.data() + value.size() || result < 0.0)
+		{
+			throw std::runtime_error("Invalid numeric argument");
+		}
+		return result;
+	}
+
+	// Accepts: [--alpha P] [--threshold PERCENT] [--min-delta NS] BASELINE CURRENT
+	CompareOptions ParseCompareOptions(int argc, char **argv)
+	{
+		CompareOptions options{};
+		std::vector<std::string> paths;
+		for (auto i = 1; i < argc; ++i)
+		{
+			const std::string_view argument{argv[i]};
+			const auto next = [&]() -> std::string_view
+			{
+				if (i + 1 >= argc)
+				{
+					throw std::runtime_error("Missing value for argument");
+				}
+				return argv[++i];
+			};
+
+			if (argument == "--alpha")
+			{
+				options.alpha = ParseDouble(next());
+			}
+			else if (argument == "--threshold")
+			{
+				options.threshold = ParseDouble(next());
+			}
+			else if (argument == "--min-delta")
+			{
+				options.minDelta = ParseDouble(next());
+			}
+			else if (argument.starts_with("--"))
+			{
+				throw std::runtime_error("Unknown argument");
+			}
+			else
+			{
+				paths.emplace_back(argument);
+			}
+		}
+
+		if (paths.size() != 2)
+		{
+			throw std::runtime_error("Usage: aoc_compare [--alpha P] [--threshold PERCENT] [--min-delta NS] BASELINE CURRENT");
+		}
+		options.baselinePath = std::move(paths[0]);
+		options.currentPath = std::move(paths[1]);
+		return options;
+	}
+
+	// Either the bench.json array or a single report written by --json.
+	std::vector<JsonValue> LoadReports(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file " + path);
+		}
+		const std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+		auto document = ParseJson(contents);
+		if (document.type == JsonValue::Type::Array)
+		{
+			return std::move(document.array);
+		}
+		return {std::move(document)};
+	}
+
+	const JsonValue *FindNamed(const std::vector<JsonValue> &values, const std::string &name)
+	{
+		for (const auto &value: values)
+		{
+			const auto *member = value.Find("name");
+			if (member != nullptr && member->string == name)
+			{
+				return &value;
+			}
+		}
+		return nullptr;
+	}
+
+	std::vector<double> Samples(const JsonValue &phase)
+	{
+		std::vector<double> samples;
+		if (const auto *values = phase.Find("samples_ns"); values != nullptr)
+		{
+			for (const auto &value: values->array)
+			{
+				samples.push_back(value.number);
+			}
+		}
+		return samples;
+	}
+
+	double ChangePercent(double baseline, double current)
+	{
+		return baseline == 0.0 ? 0.0 : (current - baseline) / baseline * 100.0;
+	}
+
+	std::string FormatMicroseconds(double nanoseconds)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(1) << nanoseconds / 1000.0 << "us";
+		return stream.str();
+	}
+
+	std::string FormatChange(double percent)
+	{
+		std::ostringstream stream;
+		stream << std::showpos << std::fixed << std::setprecision(1) << percent << "%";
+		return stream.str();
+	}
+
+	class Comparison
+	{
+	public:
+		explicit Comparison(const CompareOptions &options) : _options(options)
+		{}
+
+		void CompareDay(const JsonValue &baseline, const JsonValue &current)
+		{
+			const auto &day = current.At("name").string;
+			CompareResults(day, baseline, current);
+
+			const auto &baselinePhases = baseline.At("phases").array;
+			for (const auto &phase: current.At("phases").array)
+			{
+				const auto &name = phase.At("name").string;
+				const auto *previous = FindNamed(baselinePhases, name);
+				if (previous == nullptr)
+				{
+					_notes << day << " " << name << ": not in the baseline\r\n";
+					continue;
+				}
+				ComparePhase(day, name, *previous, phase);
+				CompareAllocations(day, name, *previous, phase);
+			}
+			for (const auto &phase: baselinePhases)
+			{
+				if (FindNamed(current.At("phases").array, phase.At("name").string) == nullptr)
+				{
+					Missing(day + " " + phase.At("name").string);
+				}
+			}
+		}
+
+		void Note(const std::string &note)
+		{
+			_notes << note << "\r\n";
+		}
+
+		// A day or phase that stopped being measured could hide any slowdown, so it fails the comparison.
+		void Missing(const std::string &what)
+		{
+			_notes << what << ": missing from the current run (REGRESSION)\r\n";
+			++_regressions;
+		}
+
+		void Print(std::ostream &os) const
+		{
+			os << std::left << std::setw(DayWidth) << "Day" << std::setw(PhaseWidth) << "Phase"
+			   << std::right << std::setw(ColumnWidth) << "baseline" << std::setw(ColumnWidth) << "current"
+			   << std::setw(ColumnWidth) << "change" << std::setw(ColumnWidth) << "p" << "  verdict\r\n";
+			os << _timings.str();
+
+			if (!_allocations.str().empty())
+			{
+				os << "\r\n" << std::left << std::setw(DayWidth) << "Day" << std::setw(PhaseWidth) << "Phase"
+				   << std::setw(ColumnWidth) << "counter" << std::right << std::setw(ColumnWidth) << "baseline"
+				   << std::setw(ColumnWidth) << "current" << std::setw(ColumnWidth) << "change" << "  verdict\r\n";
+				os << _allocations.str();
+			}
+
+			if (!_notes.str().empty())
+			{
+				os << "\r\n" << _notes.str();
+			}
+
+			os << "\r\n" << _regressions << " regression" << (_regressions == 1 ? "" : "s")
+			   << " (alpha " << _options.alpha << ", threshold " << _options.threshold << "%, min delta "
+			   << _options.minDelta << "ns)\r\n";
+		}
+
+		[[nodiscard]] std::size_t Regressions() const
+		{
+			return _regressions;
+		}
+
+	private:
+		void CompareResults(const std::string &day, const JsonValue &baseline, const JsonValue &current)
+		{
+			// Answers only have to match when both runs solved the same input.
+			if (baseline.At("input").string != current.At("input").string ||
+			    baseline.At("input_bytes").number != current.At("input_bytes").number)
+			{
+				return;
+			}
+			for (const auto &[name, value]: current.At("results").object)
+			{
+				const auto *previous = baseline.At("results").Find(name);
+				if (previous != nullptr && previous->string != value.string)
+				{
+					_notes << day << " " << name << ": result changed from " << previous->string << " to "
+					       << value.string << " (REGRESSION)\r\n";
+					++_regressions;
+				}
+			}
+		}
+
+		void ComparePhase(const std::string &day, const std::string &phase, const JsonValue &baseline,
+		                  const JsonValue &current)
+		{
+			const auto baselineMedian = baseline.At("median_ns").number;
+			const auto currentMedian = current.At("median_ns").number;
+			const auto change = ChangePercent(baselineMedian, currentMedian);
+			const auto p = MannWhitneyP(Samples(baseline), Samples(current));
+
+			std::string verdict = "~";
+			if (p < _options.alpha && change > _options.threshold &&
+			    currentMedian - baselineMedian > _options.minDelta)
+			{
+				verdict = "REGRESSION";
+				++_regressions;
+			}
+			else if (p < _options.alpha && change < -_options.threshold &&
+			         baselineMedian - currentMedian > _options.minDelta)
+			{
+				verdict = "faster";
+			}
+
+			_timings << std::left << std::setw(DayWidth) << day << std::setw(PhaseWidth) << phase
+			         << std::right << std::setw(ColumnWidth) << FormatMicroseconds(baselineMedian)
+			         << std::setw(ColumnWidth) << FormatMicroseconds(currentMedian)
+			         << std::setw(ColumnWidth) << FormatChange(change)
+			         << std::setw(ColumnWidth) << std::setprecision(3) << p << "  " << verdict << "\r\n";
+		}
+
+		// Allocation counts are medians and almost deterministic, so any growth beyond the threshold fails.
+		void CompareAllocations(const std::string &day, const std::string &phase, const JsonValue &baseline,
+		                        const JsonValue &current)
+		{
+			const auto *baselineAllocations = baseline.Find("allocations");
+			const auto *currentAllocations = current.Find("allocations");
+			if (baselineAllocations == nullptr || currentAllocations == nullptr)
+			{
+				return;
+			}
+			for (const auto *counter: {"count", "bytes"})
+			{
+				const auto before = baselineAllocations->At(counter).number;
+				const auto after = currentAllocations->At(counter).number;
+				const auto change = after > before && before == 0.0 ? 100.0 : ChangePercent(before, after);
+				std::string verdict = "~";
+				if (after > before && change > _options.threshold)
+				{
+					verdict = "REGRESSION";
+					++_regressions;
+				}
+				_allocations << std::left << std::setw(DayWidth) << day << std::setw(PhaseWidth) << phase
+				             << std::setw(ColumnWidth) << counter << std::right << std::fixed << std::setprecision(0)
+				             << std::setw(ColumnWidth) << before << std::setw(ColumnWidth) << after
+				             << std::defaultfloat << std::setw(ColumnWidth) << FormatChange(change) << "  "
+				             << verdict << "\r\n";
+			}
+		}
+
+	private:
+		const CompareOptions &_options;
+		std::ostringstream _timings;
+		std::ostringstream _allocations;
+		std::ostringstream _notes;
+		std::size_t _regressions = 0;
+	};
+}
+
+// Compares two harness JSON reports, usually bench.json from the bench target against a saved baseline.
+// Usage: aoc_compare [--alpha P] [--threshold PERCENT] [--min-delta NS] BASELINE CURRENT
+// A phase regresses when its samples differ significantly and the median slowed down by more than both the
+// threshold and the minimum delta. Exits with 1 on any regression, growth in allocations, changed result or
+// day or phase missing from the current run.
+int main(int argc, char **argv)
+{
+	const auto options = ParseCompareOptions(argc, argv);
+	const auto baseline = LoadReports(options.baselinePath);
+	const auto current = LoadReports(options.currentPath);
+
+	Comparison comparison{options};
+	for (const auto &report: current)
+	{
+		const auto &name = report.At("name").string;
+		const auto *previous = FindNamed(baseline, name);
+		if (previous == nullptr)
+		{
+			comparison.Note(name + ": not in the baseline");
+			continue;
+		}
+		comparison.CompareDay(*previous, report);
+	}
+	for (const auto &report: baseline)
+	{
+		if (FindNamed(current, report.At("name").string) == nullptr)
+		{
+			comparison.Missing(report.At("name").string);
+		}
+	}
+
+	comparison.Print(std::cout);
+	return comparison.Regressions() == 0 ? 0 : 1;
+}
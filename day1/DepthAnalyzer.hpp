@@ -0,0 +1,106 @@
+#ifndef ADVENTOFCODE2021_DEPTHANALYZER_HPP
+#define ADVENTOFCODE2021_DEPTHANALYZER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace day1
+{
+
+// Incremental form of both parts for readings that arrive one at a time or in batches, e.g. live sonar
+// telemetry. A sum of k readings increases exactly when the reading entering it is larger than the one
+// leaving it, so only the last max(part1Window, part2Window) readings are kept, in a ring buffer.
+// Counts can be read at any moment and cover every reading pushed so far.
+template<class T>
+class DepthAnalyzer
+{
+	static_assert(std::is_integral_v<T>, "Depth readings must be integers");
+
+public:
+	explicit DepthAnalyzer(std::size_t part1Window = 1, std::size_t part2Window = 3)
+			: _part1Window(part1Window), _part2Window(part2Window),
+			  _ring(std::bit_ceil(std::max(part1Window, part2Window)))
+	{
+		if (part1Window == 0 || part2Window == 0)
+		{
+			throw std::runtime_error("Invalid window size");
+		}
+	}
+
+	void Push(T depth)
+	{
+		const auto mask = _ring.size() - 1;
+		if (_count >= _part1Window && depth > _ring[(_count - _part1Window) & mask])
+		{
+			++_part1;
+		}
+		if (_count >= _part2Window && depth > _ring[(_count - _part2Window) & mask])
+		{
+			++_part2;
+		}
+		_ring[_count & mask] = depth;
+		++_count;
+	}
+
+	void Push(std::span<const T> depths)
+	{
+		// Once a window's worth of the batch is in, the rest is compared within the batch and only the
+		// readings still needed afterwards are copied into the ring.
+		const auto head = std::min(depths.size(), _ring.size());
+		for (std::size_t i = 0; i < head; ++i)
+		{
+			Push(depths[i]);
+		}
+
+		std::uint64_t part1 = 0;
+		std::uint64_t part2 = 0;
+		for (auto i = head; i < depths.size(); ++i)
+		{
+			part1 += depths[i] > depths[i - _part1Window] ? 1 : 0;
+			part2 += depths[i] > depths[i - _part2Window] ? 1 : 0;
+		}
+		_part1 += part1;
+		_part2 += part2;
+
+		const auto start = _count - head;
+		const auto mask = _ring.size() - 1;
+		for (auto i = std::max(head, depths.size() - std::min(depths.size(), _ring.size())); i < depths.size(); ++i)
+		{
+			_ring[(start + i) & mask] = depths[i];
+		}
+		_count = start + depths.size();
+	}
+
+	[[nodiscard]] std::uint64_t Part1() const
+	{
+		return _part1;
+	}
+
+	[[nodiscard]] std::uint64_t Part2() const
+	{
+		return _part2;
+	}
+
+	[[nodiscard]] std::uint64_t Count() const
+	{
+		return _count;
+	}
+
+private:
+	std::size_t _part1Window;
+	std::size_t _part2Window;
+	// Reading n is kept at n & (size - 1) until it falls out of both windows.
+	std::vector<T> _ring;
+	std::uint64_t _count = 0;
+	std::uint64_t _part1 = 0;
+	std::uint64_t _part2 = 0;
+};
+
+}
+
+#endif //ADVENTOFCODE2021_DEPTHANALYZER_HPP
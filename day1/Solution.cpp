@@ -0,0 +1,88 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "DepthAnalyzer.hpp"
+#include "ThreadPool.hpp"
+#include "WindowIncreases.hpp"
+#include <iostream>
+
+namespace day1
+{
+
+// Archived series are parsed on the default pool from this size on, smaller inputs are not worth the tasks.
+constexpr std::size_t ParallelParseThreshold = std::size_t{1} << 20;
+
+std::uint64_t SolvePart1(const std::vector<uint16_t> &input);
+std::uint64_t SolvePart2(const std::vector<uint16_t> &input);
+
+// Fold for --stream runs, the analyzer keeps only the last three readings.
+class DepthFold
+{
+public:
+	void Consume(std::string_view line)
+	{
+		if (!line.empty())
+		{
+			_analyzer.Push(StrToInteger<std::uint64_t>(line));
+		}
+	}
+
+	[[nodiscard]] std::uint64_t Part1() const
+	{
+		return _analyzer.Part1();
+	}
+
+	[[nodiscard]] std::uint64_t Part2() const
+	{
+		return _analyzer.Part2();
+	}
+
+private:
+	DepthAnalyzer<std::uint64_t> _analyzer;
+};
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 const auto depths = PackedReader{file.Contents(), 1}.Array<std::uint16_t>(0);
+			                 return std::vector<std::uint16_t>(depths.begin(), depths.end());
+		                 }
+		                 if (file.Contents().size() >= ParallelParseThreshold)
+		                 {
+			                 return ParseIntegerListParallel<std::uint16_t>(file.Contents(), DefaultPool());
+		                 }
+		                 return ParseIntegerList<std::uint16_t>(file.Contents());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+	RegisterStreamingFold<DepthFold>(harness);
+}
+
+// A single U16 column of depths.
+std::string Pack(const InputFile &input)
+{
+	PackedWriter writer{1};
+	writer.AddArray<std::uint16_t>(ParseIntegerList<std::uint16_t>(input.Contents()));
+	return writer.Finish();
+}
+
+
+std::uint64_t SolvePart1(const std::vector<uint16_t> &input)
+{
+	return CountWindowIncreases(input, 1, DefaultPool());
+}
+
+std::uint64_t SolvePart2(const std::vector<uint16_t> &input)
+{
+	return CountWindowIncreases(input, 3, DefaultPool());
+}
+
+}
@@ -0,0 +1,151 @@
+#include "WindowIncreases.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace day1
+{
+
+namespace
+{
+	// Positions counted by one task, 128 KiB of readings.
+	constexpr std::size_t ChunkGrain = std::size_t{1} << 16;
+
+	// Counts positions [0, count) with later[i] > earlier[i].
+	using CountFunction = std::uint64_t (*)(const std::uint16_t *earlier, const std::uint16_t *later, std::size_t count);
+
+	std::uint64_t CountScalar(const std::uint16_t *earlier, const std::uint16_t *later, std::size_t count)
+	{
+		std::uint64_t result = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			result += later[i] > earlier[i] ? 1 : 0;
+		}
+		return result;
+	}
+
+#ifdef AOC_X86_KERNELS
+	// The 16 bit lane counters are flushed before they can overflow as signed values in the madd.
+	constexpr std::size_t FlushInterval = 0x7fff;
+
+	__attribute__((target("sse4.1")))
+	std::uint64_t CountSse41(const std::uint16_t *earlier, const std::uint16_t *later, std::size_t count)
+	{
+		constexpr std::size_t Lanes = 8;
+		const auto ones = _mm_set1_epi16(1);
+
+		std::uint64_t notIncreasing = 0;
+		std::size_t i = 0;
+		while (i + Lanes <= count)
+		{
+			const auto end = std::min(count - count % Lanes, i + FlushInterval * Lanes);
+			auto counters = _mm_setzero_si128();
+			for (; i < end; i += Lanes)
+			{
+				const auto before = _mm_loadu_si128(reinterpret_cast<const __m128i *>(earlier + i));
+				const auto after = _mm_loadu_si128(reinterpret_cast<const __m128i *>(later + i));
+				// after <= before exactly where max(after, before) == before, all ones adds one per lane.
+				counters = _mm_sub_epi16(counters, _mm_cmpeq_epi16(_mm_max_epu16(after, before), before));
+			}
+			const auto pairs = _mm_madd_epi16(counters, ones);
+			alignas(16) std::uint32_t sums[4];
+			_mm_store_si128(reinterpret_cast<__m128i *>(sums), pairs);
+			notIncreasing += std::uint64_t{sums[0]} + sums[1] + sums[2] + sums[3];
+		}
+		return i - notIncreasing + CountScalar(earlier + i, later + i, count - i);
+	}
+
+	__attribute__((target("avx2")))
+	std::uint64_t CountAvx2(const std::uint16_t *earlier, const std::uint16_t *later, std::size_t count)
+	{
+		constexpr std::size_t Lanes = 16;
+		const auto ones = _mm256_set1_epi16(1);
+
+		std::uint64_t notIncreasing = 0;
+		std::size_t i = 0;
+		while (i + Lanes <= count)
+		{
+			const auto end = std::min(count - count % Lanes, i + FlushInterval * Lanes);
+			auto counters = _mm256_setzero_si256();
+			for (; i < end; i += Lanes)
+			{
+				const auto before = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(earlier + i));
+				const auto after = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(later + i));
+				counters = _mm256_sub_epi16(counters, _mm256_cmpeq_epi16(_mm256_max_epu16(after, before), before));
+			}
+			const auto pairs = _mm256_madd_epi16(counters, ones);
+			alignas(32) std::uint32_t sums[8];
+			_mm256_store_si256(reinterpret_cast<__m256i *>(sums), pairs);
+			for (const auto sum: sums)
+			{
+				notIncreasing += sum;
+			}
+		}
+		return i - notIncreasing + CountScalar(earlier + i, later + i, count - i);
+	}
+#endif
+
+	std::pair<CountFunction, std::string_view> SelectKernel()
+	{
+#ifdef AOC_X86_KERNELS
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {CountAvx2, "avx2"};
+		}
+		if (__builtin_cpu_supports("sse4.1"))
+		{
+			return {CountSse41, "sse4.1"};
+		}
+#endif
+		return {CountScalar, "scalar"};
+	}
+
+	const std::pair<CountFunction, std::string_view> &Kernel()
+	{
+		static const auto kernel = SelectKernel();
+		return kernel;
+	}
+}
+
+std::uint64_t CountWindowIncreases(std::span<const std::uint16_t> depths, std::size_t window)
+{
+	if (window == 0 || depths.size() <= window)
+	{
+		return 0;
+	}
+	return Kernel().first(depths.data(), depths.data() + window, depths.size() - window);
+}
+
+std::uint64_t CountWindowIncreases(std::span<const std::uint16_t> depths, std::size_t window, ThreadPool &pool)
+{
+	if (window == 0 || depths.size() <= window)
+	{
+		return 0;
+	}
+	const auto count = Kernel().first;
+	const auto *data = depths.data();
+	const auto positions = depths.size() - window;
+	return ParallelReduce(pool, 0, (positions + ChunkGrain - 1) / ChunkGrain, 1, std::uint64_t{0},
+	                      [&](std::size_t chunk)
+	                      {
+		                      const auto first = chunk * ChunkGrain;
+		                      const auto last = std::min(positions, first + ChunkGrain);
+		                      return count(data + first, data + first + window, last - first);
+	                      },
+	                      std::plus<>{});
+}
+
+std::string_view WindowIncreasesKernel()
+{
+	return Kernel().second;
+}
+
+}
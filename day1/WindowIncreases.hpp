@@ -0,0 +1,28 @@
+#ifndef ADVENTOFCODE2021_WINDOWINCREASES_HPP
+#define ADVENTOFCODE2021_WINDOWINCREASES_HPP
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+class ThreadPool;
+
+namespace day1
+{
+
+// Number of positions i with depths[i + window] > depths[i]. Consecutive sums of window readings share
+// all but one reading, so this is also how often such a sum increases: part 1 is window 1, part 2 window 3.
+// Compares 16 readings at once with AVX2 or 8 with SSE4.1 when the CPU supports it.
+[[nodiscard]] std::uint64_t CountWindowIncreases(std::span<const std::uint16_t> depths, std::size_t window);
+
+// Same count with the positions split into chunks that are counted concurrently on the pool. A chunk also
+// reads the window readings after its last position, so comparisons across a chunk boundary count once.
+[[nodiscard]] std::uint64_t CountWindowIncreases(std::span<const std::uint16_t> depths, std::size_t window,
+                                                 ThreadPool &pool);
+
+// Name of the kernel picked for this CPU ("avx2", "sse4.1" or "scalar").
+[[nodiscard]] std::string_view WindowIncreasesKernel();
+
+}
+
+#endif //ADVENTOFCODE2021_WINDOWINCREASES_HPP
@@ -0,0 +1,259 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <stack>
+
+namespace day10
+{
+
+std::uint64_t SolvePart1(const std::vector<std::string_view> &lines);
+std::uint64_t SolvePart2(const std::vector<std::string_view> &lines);
+
+std::uint64_t ValidateLine(std::string_view line);
+std::uint64_t RepairLine(std::string_view line);
+
+// Fold for --stream runs. Part 1 is a running sum, the part 2 median needs the completion scores of
+// the incomplete lines, eight bytes per line instead of the line itself.
+class NavigationFold
+{
+public:
+	void Consume(std::string_view line)
+	{
+		_syntaxErrorScore += ValidateLine(line);
+		if (const auto score = RepairLine(line); score > 0)
+		{
+			_completionScores.push_back(score);
+		}
+	}
+
+	[[nodiscard]] std::uint64_t Part1() const
+	{
+		return _syntaxErrorScore;
+	}
+
+	[[nodiscard]] std::uint64_t Part2()
+	{
+		if (_completionScores.empty())
+		{
+			throw std::runtime_error("No incomplete lines");
+		}
+		const auto middle = _completionScores.begin() + static_cast<std::ptrdiff_t>(_completionScores.size() / 2);
+		std::nth_element(_completionScores.begin(), middle, _completionScores.end());
+		return *middle;
+	}
+
+private:
+	std::uint64_t _syntaxErrorScore = 0;
+	std::vector<std::uint64_t> _completionScores;
+};
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return file.Lines();
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+	RegisterStreamingFold<NavigationFold>(harness);
+}
+
+std::uint64_t SolvePart1(const std::vector<std::string_view> &lines)
+{
+	// Navigation lines are scored independently, chunks of them are checked concurrently.
+	return ParallelReduce(0, lines.size(), 1024, std::uint64_t{0}, [&lines](std::size_t i)
+	{
+		return ValidateLine(lines[i]);
+	}, std::plus<>{});
+}
+
+std::uint64_t SolvePart2(const std::vector<std::string_view> &lines)
+{
+	auto scores = ParallelMap(0, lines.size(), 1024, [&lines](std::size_t i)
+	{
+		return RepairLine(lines[i]);
+	});
+	scores.erase(std::remove(scores.begin(), scores.end(), 0), scores.end());
+
+	std::sort(scores.begin(), scores.end());
+
+	return scores[scores.size() / 2];
+}
+
+std::uint64_t ValidateLine(std::string_view line)
+{
+	std::stack<char> stack;
+
+	for (const auto &c: line)
+	{
+		switch (c)
+		{
+			case '(':
+			case '[':
+			case '{':
+			case '<':
+				stack.push(c);
+				break;
+			case ')':
+			{
+				if (stack.top() != '(')
+				{
+					return 3;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case ']':
+			{
+				if (stack.top() != '[')
+				{
+					return 57;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case '}':
+			{
+				if (stack.top() != '{')
+				{
+					return 1197;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case '>':
+			{
+				if (stack.top() != '<')
+				{
+					return 25137;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			default:
+				throw std::runtime_error("Unexpected character");
+		}
+	}
+
+
+	return 0;
+}
+
+std::uint64_t RepairLine(std::string_view line)
+{
+	std::stack<char> stack;
+
+	for (const auto &c: line)
+	{
+		switch (c)
+		{
+			case '(':
+			case '[':
+			case '{':
+			case '<':
+				stack.push(c);
+				break;
+			case ')':
+			{
+				if (stack.top() != '(')
+				{
+					return 0;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case ']':
+			{
+				if (stack.top() != '[')
+				{
+					return 0;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case '}':
+			{
+				if (stack.top() != '{')
+				{
+					return 0;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			case '>':
+			{
+				if (stack.top() != '<')
+				{
+					return 0;
+				}
+				else
+				{
+					stack.pop();
+					break;
+				}
+			}
+			default:
+				throw std::runtime_error("Unexpected character");
+		}
+	}
+
+	std::uint64_t result {};
+	while (!stack.empty())
+	{
+		const auto c = stack.top();
+
+		result *= 5;
+		switch (c)
+		{
+			case '(':
+				result += 1;
+				break;
+			case '[':
+				result += 2;
+				break;
+			case '{':
+				result += 3;
+				break;
+			case '<':
+				result += 4;
+				break;
+			default:
+				throw std::runtime_error("Unexpected character");
+		}
+
+		stack.pop();
+	}
+
+	return result;
+}
+
+}
@@ -0,0 +1,150 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "Grid2D.hpp"
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace day11
+{
+
+// Border cells start far above the flash level and are reset every step, they absorb increments
+// from flashing neighbours but never reach exactly 10 themselves.
+constexpr std::uint8_t BorderEnergy = 128;
+using OctopusGrid = Grid2D<std::uint8_t>;
+
+
+OctopusGrid ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(OctopusGrid grid);
+std::uint64_t SolvePart2(OctopusGrid grid);
+
+std::uint64_t SimulateStep(OctopusGrid &grid, std::vector<std::size_t> &positionsToFlash);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return ReadDigitGrid<std::uint8_t>(PackedReader{file.Contents(), 11}, 0, 1, std::uint8_t{BorderEnergy});
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::string Pack(const InputFile &input)
+{
+	PackedWriter writer{11};
+	AddDigitGrid(writer, input.Lines());
+	return writer.Finish();
+}
+
+OctopusGrid ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.empty())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	const auto width = lines.front().length();
+	OctopusGrid result{width, lines.size(), 1, 0, BorderEnergy};
+
+	for (auto y = 0U; y < lines.size(); ++y)
+	{
+		if (lines[y].length() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		auto index = result.Index(0, y);
+		for (const auto &c: lines[y])
+		{
+			result[index++] = (c - '0');
+		}
+	}
+
+	return result;
+}
+
+std::uint64_t SolvePart1(OctopusGrid grid)
+{
+	std::vector<std::size_t> positionsToFlash;
+	std::uint64_t result {};
+	for (auto i = 1U; i <= 100U; ++i)
+	{
+		result += SimulateStep(grid, positionsToFlash);
+	}
+	return result;
+}
+
+std::uint64_t SolvePart2(OctopusGrid grid)
+{
+	std::vector<std::size_t> positionsToFlash;
+	for (auto i = 1U; i <= 1000U; ++i)
+	{
+		if (SimulateStep(grid, positionsToFlash) == grid.Width() * grid.Height())
+		{
+			return i;
+		}
+	}
+	throw std::runtime_error("Failed to solve part 2");
+}
+
+
+std::uint64_t SimulateStep(OctopusGrid &grid, std::vector<std::size_t> &positionsToFlash)
+{
+	const auto offsets = grid.Offsets(Neighbours8);
+
+	// An octopus flashes exactly once, when its energy reaches 10, later increments only raise it further.
+	for (auto y = 0U; y < grid.Height(); ++y)
+	{
+		auto index = grid.Index(0, y);
+		for (auto x = 0U; x < grid.Width(); ++x, ++index)
+		{
+			if (++grid[index] == 10)
+			{
+				positionsToFlash.push_back(index);
+			}
+		}
+	}
+
+	while (!positionsToFlash.empty())
+	{
+		const auto index = positionsToFlash.back();
+		positionsToFlash.pop_back();
+
+		for (const auto offset: offsets)
+		{
+			if (++grid[index + offset] == 10)
+			{
+				positionsToFlash.push_back(index + offset);
+			}
+		}
+	}
+
+	std::uint64_t flashes {};
+	for (auto y = 0U; y < grid.Height(); ++y)
+	{
+		auto index = grid.Index(0, y);
+		for (auto x = 0U; x < grid.Width(); ++x, ++index)
+		{
+			if (grid[index] > 9)
+			{
+				grid[index] = 0;
+				++flashes;
+			}
+		}
+	}
+	grid.FillBorder(BorderEnergy);
+	return flashes;
+}
+
+}
@@ -1,5 +1,10 @@
 #include "Cave.hpp"
 
+#include <algorithm>
+
+namespace day12
+{
+
 bool Cave::IsBig() const
 {
 	return std::all_of(name.begin(), name.end(),
@@ -9,3 +14,5 @@ bool Cave::IsBig() const
 	                   }
 	);
 }
+
+}
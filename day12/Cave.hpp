@@ -6,7 +6,8 @@
 #include <vector>
 #include <unordered_map>
 
-
+namespace day12
+{
 
 struct Cave
 {
@@ -15,5 +16,6 @@ struct Cave
 	[[nodiscard]] bool IsBig() const;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_CAVE_HPP
@@ -0,0 +1,232 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Grid2D.hpp"
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <array>
+#include <sstream>
+
+namespace day13
+{
+
+enum class Cell
+{
+	Empty,
+	Dot
+};
+
+enum class FoldDirection
+{
+	x,
+	y
+};
+
+struct FoldInstruction
+{
+	FoldDirection direction;
+	std::uint16_t line;
+};
+
+using Origami = Grid2D<Cell>;
+
+std::pair<Origami, std::vector<FoldInstruction>> ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(const Origami &origami, const std::vector<FoldInstruction> &instructions);
+
+std::string SolvePart2(Origami origami, const std::vector<FoldInstruction> &instructions);
+
+Origami PerformFold(const Origami &origami, const FoldInstruction &instruction);
+
+
+std::string StringifyOrigami(const Origami &origami, char emptyChar);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart1(input.first, input.second);
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart2(input.first, input.second);
+	                 });
+}
+
+std::pair<Origami, std::vector<FoldInstruction>> ParseInput(const std::vector<std::string_view> &lines)
+{
+	auto sep = std::find_if(lines.begin(), lines.end(), [](std::string_view line)
+	{ return line.empty(); });
+	if (sep == lines.end())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	std::vector<std::pair<std::uint16_t, std::uint16_t>> dots{};
+	dots.reserve(std::distance(lines.begin(), sep));
+
+	std::uint16_t width{};
+	std::uint16_t height{};
+
+
+	for (auto it = lines.begin(); it != sep; ++it)
+	{
+		const auto [x, y] = ParseIntegers<std::int16_t, 2>(SplitView{*it, ','});
+
+		dots.emplace_back(x, y);
+		width = std::max(width, dots.back().first);
+		height = std::max(height, dots.back().second);
+	}
+	width += 1; // account for 0 based indexes
+	height += 1; // account for 0 based indexes
+
+	Origami origami{width, height, 0, Cell::Empty};
+
+	for (const auto &dot: dots)
+	{
+		origami(dot.first, dot.second) = Cell::Dot;
+	}
+
+	std::vector<FoldInstruction> instructions;
+	instructions.reserve(std::distance(std::next(sep), lines.end()));
+	for (auto it = std::next(sep); it != lines.end(); ++it)
+	{
+		const auto words = SplitTokens<3>(SplitView{*it});
+		const auto elements = SplitTokens<2>(SplitView{words[2], '='});
+
+		FoldInstruction instruction{};
+
+		switch (elements.front().front())
+		{
+			case 'y':
+				instruction.direction = FoldDirection::y;
+				break;
+			case 'x':
+				instruction.direction = FoldDirection::x;
+				break;
+		}
+		instruction.line = StrToInteger<std::uint16_t>(elements[1]);
+
+		instructions.push_back(instruction);
+	}
+
+	return {std::move(origami), std::move(instructions)};
+}
+
+std::uint64_t SolvePart1(const Origami &origami, const std::vector<FoldInstruction> &instructions)
+{
+	auto folded = PerformFold(origami, instructions.front());
+#ifndef NDEBUG
+	std::cout << StringifyOrigami(folded, '.');
+#endif
+	std::uint64_t result{};
+	for (auto y = 0U; y < folded.Height(); ++y)
+	{
+		for (auto x = 0U; x < folded.Width(); ++x)
+		{
+			result += folded(x, y) == Cell::Dot;
+		}
+	}
+	return result;
+}
+
+std::string SolvePart2(Origami origami, const std::vector<FoldInstruction> &instructions)
+{
+	for (const auto &instruction: instructions)
+	{
+		origami = PerformFold(origami, instruction);
+	}
+
+	return StringifyOrigami(origami, ' ');
+}
+
+Origami PerformFold(const Origami &origami, const FoldInstruction &instruction)
+{
+	const auto width = origami.Width();
+	const auto height = origami.Height();
+
+	if (instruction.direction == FoldDirection::y)
+	{
+		const std::size_t topPart = instruction.line;
+		const auto bottomPart = height - (instruction.line + 1);
+
+		if (topPart < bottomPart)
+		{
+			throw std::runtime_error("Size mismatch");
+		}
+		const auto assumedHeight = height + (topPart - bottomPart);
+
+		Origami folded{width, topPart};
+		for (auto y = 0U; y < topPart; ++y)
+		{
+			const auto bottomLine = assumedHeight - 1 - y;
+			for (auto x = 0U; x < width; ++x)
+			{
+				const auto mirrored = bottomLine < height ? origami(x, bottomLine) : Cell::Empty;
+				folded(x, y) = (origami(x, y) == Cell::Dot || mirrored == Cell::Dot) ? Cell::Dot : Cell::Empty;
+			}
+		}
+		return folded;
+	}
+	else if (instruction.direction == FoldDirection::x)
+	{
+		const std::size_t leftPart = instruction.line;
+		const auto rightPart = width - (instruction.line + 1);
+
+		if (leftPart < rightPart)
+		{
+			throw std::runtime_error("Size mismatch");
+		}
+
+		const auto assumedWidth = width + (leftPart - rightPart);
+
+		Origami folded{leftPart, height};
+		for (auto y = 0U; y < height; ++y)
+		{
+			for (auto x = 0U; x < leftPart; ++x)
+			{
+				const auto rightColumn = assumedWidth - 1 - x;
+				const auto mirrored = rightColumn < width ? origami(rightColumn, y) : Cell::Empty;
+				folded(x, y) = (origami(x, y) == Cell::Dot || mirrored == Cell::Dot) ? Cell::Dot : Cell::Empty;
+			}
+		}
+		return folded;
+	}
+	else
+	{
+		throw std::runtime_error("Invalid instruction");
+	}
+}
+
+std::string StringifyOrigami(const Origami &origami, char emptyChar)
+{
+	std::ostringstream stream;
+	for (auto y = 0U; y < origami.Height(); ++y)
+	{
+		for (auto x = 0U; x < origami.Width(); ++x)
+		{
+			if (origami(x, y) == Cell::Dot)
+			{
+				stream << "#";
+			}
+			else
+			{
+				stream << emptyChar;
+			}
+		}
+		stream << "\r\n";
+	}
+	return stream.str();
+}
+
+}
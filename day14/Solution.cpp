@@ -0,0 +1,219 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+namespace day14
+{
+
+struct Polymer
+{
+	std::unordered_map<std::string, size_t> elements;
+	char lastElement;
+};
+
+using Substituitions = std::unordered_map<std::string, char>;
+std::pair<Polymer, Substituitions> ParseInput(const std::vector<std::string_view> &lines);
+void ParseSubstitution(std::string_view line, Substituitions &substitutions);
+ResultValues SolveStream(ChunkReader &reader);
+
+std::uint64_t SolvePart1(const Polymer &polymer, const Substituitions &substitutions);
+std::uint64_t SolvePart2(const Polymer &polymer, const Substituitions &substitutions);
+
+Polymer ApplySubstitutions(const Polymer &polymer, const Substituitions &substitutions);
+std::uint64_t RunSubstitutions(Polymer polymer, const Substituitions &substitutions, std::size_t iterations);
+std::unordered_map<char, std::size_t> CountPolymerElements(const Polymer &polymer);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart1(input.first, input.second);
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart2(input.first, input.second);
+	                 });
+	harness.SetStream(SolveStream);
+}
+
+std::pair<Polymer, Substituitions> ParseInput(const std::vector<std::string_view> &lines)
+{
+	if ((lines.size() < 3) || (lines[0].empty()) || (!lines[1].empty()))
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	Polymer polymer {{}, lines[0].back()};
+	polymer.elements.reserve(lines[0].length() - 1);
+	for(auto it = lines[0].begin(); it != std::prev(lines[0].end()); ++it)
+	{
+		std::string pair{*it, *(std::next(it))};
+		polymer.elements[pair] += 1;
+	}
+
+	Substituitions instructions;
+	instructions.reserve(lines.size() - 2);
+	for (auto it = std::next(lines.begin(), 2); it != lines.end(); ++it)
+	{
+		ParseSubstitution(*it, instructions);
+	}
+
+	return std::make_pair(std::move(polymer), std::move(instructions));
+}
+
+void ParseSubstitution(std::string_view line, Substituitions &substitutions)
+{
+	const auto elems = SplitTokens<3>(SplitView{line});
+	if ((elems[1] != "->") || (elems[0].size() != 2) || (elems[2].size() != 1))
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	substitutions[std::string{elems[0]}] = elems[2].front();
+}
+
+// Solver for --stream runs. The template may be longer than a chunk, so its pairs are counted piece by
+// piece into a table indexed by the two characters; only the short rule lines are buffered.
+ResultValues SolveStream(ChunkReader &reader)
+{
+	std::vector<std::uint64_t> pairCounts(256 * 256);
+	std::optional<char> previous;
+	Substituitions substitutions;
+	std::size_t lineIndex = 0;
+	std::string line;
+
+	ForEachLinePiece(reader, [&](std::string_view piece, bool last)
+	{
+		if (lineIndex == 0)
+		{
+			for (const auto element: piece)
+			{
+				if (previous.has_value())
+				{
+					++pairCounts[static_cast<std::uint8_t>(*previous) * 256 + static_cast<std::uint8_t>(element)];
+				}
+				previous = element;
+			}
+		}
+		else
+		{
+			line.append(piece);
+		}
+		if (!last)
+		{
+			return;
+		}
+
+		if (lineIndex == 1 && !line.empty())
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		if (lineIndex >= 2)
+		{
+			ParseSubstitution(line, substitutions);
+		}
+		line.clear();
+		++lineIndex;
+	});
+
+	if (lineIndex < 3 || !previous.has_value())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	Polymer polymer{{}, *previous};
+	for (auto pair = 0U; pair < pairCounts.size(); ++pair)
+	{
+		if (pairCounts[pair] > 0)
+		{
+			polymer.elements[std::string{static_cast<char>(pair / 256), static_cast<char>(pair % 256)}] = pairCounts[pair];
+		}
+	}
+
+	return {{"Part 1", ResultToString(SolvePart1(polymer, substitutions))},
+	        {"Part 2", ResultToString(SolvePart2(polymer, substitutions))}};
+}
+
+std::uint64_t SolvePart1(const Polymer &polymer, const Substituitions &substitutions)
+{
+	return RunSubstitutions(polymer, substitutions, 10);
+}
+
+std::uint64_t SolvePart2(const Polymer &polymer, const Substituitions &substitutions)
+{
+	return RunSubstitutions(polymer, substitutions, 40);
+}
+
+std::uint64_t RunSubstitutions(Polymer polymer, const Substituitions &substitutions, std::size_t iterations)
+{
+	for (auto i = 0U; i < iterations; ++i)
+	{
+		polymer = ApplySubstitutions(polymer, substitutions);
+	}
+
+	auto count = CountPolymerElements(polymer);
+
+
+	std::vector<std::pair<char, size_t>> sortedCount{count.begin(), count.end()};
+
+	std::sort(sortedCount.begin(), sortedCount.end(), []
+			(const std::pair<char, size_t> &a, const std::pair<char, size_t> &b)
+	{
+		return a.second > b.second;
+	});
+
+	return sortedCount.front().second - sortedCount.back().second;
+}
+
+
+Polymer ApplySubstitutions(const Polymer &polymer, const Substituitions &substitutions)
+{
+	Polymer result {{}, polymer.lastElement};
+	result.elements.reserve(polymer.elements.size());
+
+
+	for (const auto  &[pair, count]: polymer.elements)
+	{
+		if (substitutions.contains(pair))
+		{
+			const std::string newPair1 = {pair.front(), substitutions.at(pair)};
+			const std::string newPair2 = {substitutions.at(pair), pair.back()};
+
+			result.elements[newPair1] += count;
+			result.elements[newPair2] += count;
+		}
+		else
+		{
+			result.elements[pair] += count;
+		}
+	}
+
+	return result;
+}
+
+std::unordered_map<char, std::size_t> CountPolymerElements(const Polymer &polymer)
+{
+	std::unordered_map<char, std::size_t> result;
+	for (const auto &[pair, count]: polymer.elements)
+	{
+		result[pair.front()] += count;
+	}
+	result[polymer.lastElement] += 1;
+	return result;
+}
+
+}
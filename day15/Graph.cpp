@@ -1,88 +1,55 @@
-
 #include "Graph.hpp"
-#include <array>
+#include "Instrumentation.hpp"
 #include <queue>
 #include <limits>
 
-
-Graph::Graph(const std::vector<std::vector<uint8_t>> &nodes)
+namespace day15
 {
-	adjacency.resize(nodes.size() * nodes.front().size());
-
-	for (auto y = 0U; y < nodes.size(); ++y)
-	{
-		for (auto x = 0U; x < nodes.front().size(); ++ x)
-		{
-			const auto sourceIndex = y * nodes.front().size() + x;
-			const auto neighbours = GetNeighbours({x, y}, nodes.front().size(), nodes.size());
-
-			for (const auto &neighbour: neighbours)
-			{
-				const auto targetIndex = neighbour.second * nodes.front().size() + neighbour.first;
-				const auto weight =nodes[neighbour.second][neighbour.first];
-				adjacency[sourceIndex].push_back(std::make_pair(targetIndex, weight));
-			}
-		}
-	}
-}
 
-std::vector<Graph::Position>Graph::GetNeighbours(const Graph::Position &currentPosition, std::int64_t maxWidth, std::int64_t maxHeight)
+Graph::Graph(const Cave &cave) : cave(cave)
 {
-	static const std::array<Position, 4> steps =
-			{
-					std::make_pair(-1, 0),
-					std::make_pair(1, 0),
-					std::make_pair(0, -1),
-					std::make_pair(0, 1),
-			};
-
-	std::vector<Position> result {};
-
-	for (const auto &step : steps)
-	{
-		auto candidate = Position(currentPosition.first + step.first, currentPosition.second + step.second);
-
-		if ((candidate.first >= 0)
-			&& (candidate.first < maxWidth)
-			&& (candidate.second >= 0)
-			&& (candidate.second < maxHeight)
-			)
-		{
-			result.push_back(candidate);
-		}
-
-
-	}
-
-	return result;
 }
 
 std::uint64_t Graph::ShortestPath() const
 {
-	std::priority_queue<std::pair<std::size_t, std::size_t>, std::vector<std::pair<std::size_t, std::size_t>>, std::greater<>> queue;
-	std::vector<std::size_t> distances(adjacency.size(), std::numeric_limits<std::size_t>::max());
+	AOC_SCOPED_TIMER("day15.ShortestPath");
+
+	// Border distances are 0, so relaxing towards the border never succeeds and needs no bounds check.
+	Grid2D<std::uint32_t> distances{cave.Width(), cave.Height(), 1, std::numeric_limits<std::uint32_t>::max(), 0};
+	const auto offsets = cave.Offsets(Neighbours4);
+	const auto start = cave.Index(0, 0);
+	const auto end = cave.Index(static_cast<std::ptrdiff_t>(cave.Width()) - 1, static_cast<std::ptrdiff_t>(cave.Height()) - 1);
 
-	queue.push(std::make_pair(0, 0));
-	distances[0] = 0;
+	std::priority_queue<std::pair<std::uint32_t, std::size_t>, std::vector<std::pair<std::uint32_t, std::size_t>>, std::greater<>> queue;
+	queue.push(std::make_pair(0, start));
+	distances[start] = 0;
 
 	while(!queue.empty())
 	{
-		const auto u = queue.top().second;
+		const auto [distance, u] = queue.top();
 		queue.pop();
+		AOC_COUNTER_INCREMENT("day15.nodes_expanded");
+		if (distance != distances[u])
+		{
+			continue;
+		}
 
-		for (auto it = adjacency[u].begin(); it != adjacency[u].end(); ++it)
+		for (const auto offset: offsets)
 		{
-			const auto v = it->first;
-			const auto weight = it->second;
+			const auto v = u + offset;
+			const auto candidate = distance + cave[v];
 
-			if (distances[v] > distances[u] + weight)
+			if (distances[v] > candidate)
 			{
-				distances[v] = distances[u] + weight;
-				queue.push(std::make_pair(distances[v], v));
+				distances[v] = candidate;
+				queue.push(std::make_pair(candidate, v));
+				AOC_COUNTER_INCREMENT("day15.queue_pushes");
 			}
 		}
 	}
 
 
-	return distances.back();
+	return distances[end];
+}
+
 }
@@ -1,24 +1,25 @@
 #ifndef ADVENTOFCODE2021_GRAPH_HPP
 #define ADVENTOFCODE2021_GRAPH_HPP
 
-#include <vector>
+#include "Grid2D.hpp"
 #include <cstdint>
 
+namespace day15
+{
+
+using Cave = Grid2D<std::uint8_t>;
+
+// Shortest path over the cave grid itself, the neighbours of a node are its four grid neighbours.
 class Graph
 {
 public:
-	using Position = std::pair<std::int64_t , std::int64_t>;
-
-	explicit Graph(const std::vector<std::vector<uint8_t>> &nodes);
+	explicit Graph(const Cave &cave);
 	std::uint64_t ShortestPath() const;
 
-
-private:
-	std::vector<Position> GetNeighbours(const Position &currentPosition, int64_t maxWidth, int64_t maxHeight);
-
 private:
-	std::vector<std::vector<std::pair<std::size_t, std::size_t>>> adjacency;
+	const Cave &cave;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_GRAPH_HPP
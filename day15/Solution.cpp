@@ -0,0 +1,92 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "Graph.hpp"
+
+namespace day15
+{
+
+Cave ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(const Cave &cave);
+std::uint64_t SolvePart2(const Cave &cave);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return ReadDigitGrid<std::uint8_t>(PackedReader{file.Contents(), 15}, 0, 1);
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::string Pack(const InputFile &input)
+{
+	PackedWriter writer{15};
+	AddDigitGrid(writer, input.Lines());
+	return writer.Finish();
+}
+
+Cave ParseInput(const std::vector<std::string_view> &lines)
+{
+	const auto width = lines[0].size();
+	Cave result{width, lines.size(), 1};
+
+	for (auto y = 0U; y < lines.size(); ++y)
+	{
+		if (lines[y].length() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		auto index = result.Index(0, y);
+		for (const auto &c: lines[y])
+		{
+			result[index++] = c - '0';
+		}
+	}
+
+	return result;
+}
+
+std::uint64_t SolvePart1(const Cave &cave)
+{
+	Graph graph(cave);
+	return graph.ShortestPath();
+}
+
+std::uint64_t SolvePart2(const Cave &cave)
+{
+	// Tile the cave 5x5, every tile step to the right or down adds one to the risk, wrapping 9 to 1.
+	const auto width = cave.Width();
+	const auto height = cave.Height();
+	Cave expanded{width * 5, height * 5, 1};
+
+	for (auto y = 0U; y < expanded.Height(); ++y)
+	{
+		auto index = expanded.Index(0, y);
+		for (auto x = 0U; x < expanded.Width(); ++x, ++index)
+		{
+			const auto risk = cave(x % width, y % height) + x / width + y / height;
+			expanded[index] = static_cast<std::uint8_t>((risk - 1) % 9 + 1);
+		}
+	}
+
+	Graph graph(expanded);
+	return graph.ShortestPath();
+}
+
+}
@@ -1,6 +1,10 @@
 #include "Packet.hpp"
 
 #include <algorithm>
+#include <stdexcept>
+
+namespace day16
+{
 
 std::uint64_t Packet::GetVersionSum() const noexcept
 {
@@ -83,3 +87,5 @@ std::uint64_t Packet::Solve() const
 			throw std::runtime_error("Unknown type");
 	}
 }
+
+}
@@ -5,6 +5,9 @@
 #include <cstdint>
 #include <variant>
 
+namespace day16
+{
+
 struct Packet
 {
 	std::uint8_t version;
@@ -15,6 +18,6 @@ struct Packet
 	[[nodiscard]] std::uint64_t Solve() const;
 };
 
-
+}
 
 #endif //ADVENTOFCODE2021_PACKET_HPP
@@ -7,6 +7,9 @@
 #include <stdexcept>
 #include <iostream>
 
+namespace day16
+{
+
 Packet Parser::ParsePackets(const std::vector<std::uint8_t> &bits)
 {
 	position = bits.begin();
@@ -135,3 +138,5 @@ std::vector<Packet> Parser::ParseSubPacketsByNumber(std::uint16_t number)
 	}
 	return subPackets;
 }
+
+}
@@ -5,6 +5,9 @@
 
 #include "Packet.hpp"
 
+namespace day16
+{
+
 class Parser
 {
 
@@ -21,5 +24,6 @@ private:
 	std::vector<std::uint8_t>::const_iterator position;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_PARSER_HPP
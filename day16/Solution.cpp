@@ -0,0 +1,84 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <charconv>
+#include <bitset>
+#include "Packet.hpp"
+#include "Parser.hpp"
+
+namespace day16
+{
+
+Packet ParseInput(const std::vector<std::string_view> &lines);
+std::vector<std::uint8_t> ParseHexadecimalString(std::string_view str);
+
+std::uint64_t SolvePart1(const Packet &packet);
+std::uint64_t SolvePart2(const Packet &packet);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+
+Packet ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.size() != 1)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	const auto bits = ParseHexadecimalString(lines.front());
+
+	Parser parser{};
+
+	return parser.ParsePackets(bits);
+}
+
+std::vector<std::uint8_t> ParseHexadecimalString(std::string_view str)
+{
+	std::vector<std::uint8_t> result {};
+	result.reserve(str.size() * 4);
+
+	for (const auto &hex: str)
+	{
+		std::uint8_t nibble {};
+		const auto convResult = std::from_chars(&hex, &hex + 1, nibble, 16);
+		if (convResult.ec != std::errc())
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		std::bitset<4> bits{nibble};
+		for(auto i = 0U; i < bits.size(); ++i)
+		{
+			result.push_back(bits[bits.size() - 1 -i] ? 1 : 0);
+		}
+	}
+
+	return result;
+}
+
+
+std::uint64_t SolvePart1(const Packet &packet)
+{
+	return packet.GetVersionSum();
+}
+
+std::uint64_t SolvePart2(const Packet &packet)
+{
+	return packet.Solve();
+}
+
+}
@@ -0,0 +1,196 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <vector>
+#include <map>
+
+namespace day17
+{
+
+using Range = std::pair<std::int64_t, std::int64_t>;
+using Target = std::pair<Range, Range>;
+
+Target ParseInput(const std::vector<std::string_view> &lines);
+
+std::int64_t SolvePart1(const Target &target);
+std::uint64_t SolvePart2(const Target &target);
+
+std::int64_t SimulateProveTrajectory(const Target &target, std::pair<std::int16_t, std::int16_t> velocity);
+bool SimulateProveTrajectory2(const Target &target, std::pair<std::int16_t, std::int16_t> velocity);
+
+Range ParseRange(std::string_view range);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+Target ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.size() != 1)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	const auto elems = SplitTokens<4>(SplitView{lines[0]});
+
+	return {ParseRange(elems[2]), ParseRange(elems[3])};
+}
+
+Range ParseRange(std::string_view range)
+{
+	const auto elems = SplitTokens<2>(SplitView{range, '='});
+	const auto bounds = SplitTokens<3>(SplitView{elems[1], '.'});
+
+	return Range(
+			StrToInteger<std::int64_t>(bounds[0]),
+			StrToInteger<std::int64_t>(bounds[2])
+	);
+}
+
+std::int64_t SolvePart1(const Target &target)
+{
+	// Heights of hitting trajectories are positive, zero means no hit.
+	const auto highest = ParallelReduce(0, 1001, 1, std::int64_t{0}, [&target](std::size_t column)
+	{
+		const auto x = static_cast<int>(column) - 500;
+		std::int64_t best{0};
+		for (auto y = -500; y <= 500; ++y)
+		{
+			best = std::max(best, SimulateProveTrajectory(target, {x, y}));
+		}
+		return best;
+	}, [](std::int64_t lhs, std::int64_t rhs)
+	{
+		return std::max(lhs, rhs);
+	});
+
+	if (highest == 0)
+	{
+		throw std::runtime_error("No trajectory hits the target");
+	}
+	return highest;
+}
+
+std::uint64_t SolvePart2(const Target &target)
+{
+	return ParallelReduce(0, 501, 1, std::uint64_t{0}, [&target](std::size_t column)
+	{
+		const auto x = static_cast<int>(column);
+		std::uint64_t hits{};
+		for (auto y = -500; y <= 500; ++y)
+		{
+			if (SimulateProveTrajectory2(target, {x, y}))
+			{
+				hits += 1;
+			}
+		}
+		return hits;
+	}, std::plus<>{});
+}
+
+std::int64_t SimulateProveTrajectory(const Target &target, std::pair<std::int16_t, std::int16_t> velocity)
+{
+	std::int64_t maxY{0};
+
+	std::int64_t xPos{0};
+	std::int64_t yPos{0};
+
+	while (true)
+	{
+		xPos += velocity.first;
+		yPos += velocity.second;
+
+		if (xPos > target.first.second)
+		{
+			return 0;
+		}
+
+		if (yPos < target.second.first)
+		{
+			return 0;
+		}
+
+		if (velocity.first != 0)
+		{
+			if (velocity.first > 0)
+			{
+				velocity.first -= 1;
+			}
+			else
+			{
+				velocity.first += 1;
+			}
+		}
+
+		velocity.second -= 1;
+		maxY = std::max(maxY, yPos);
+
+		if ((xPos >= target.first.first)
+		    && (xPos <= target.first.second)
+		    && (yPos >= target.second.first)
+		    && (yPos <= target.second.second)
+				)
+		{
+			return maxY;
+		}
+	}
+}
+
+bool SimulateProveTrajectory2(const Target &target, std::pair<std::int16_t, std::int16_t> velocity)
+{
+	std::int64_t xPos{0};
+	std::int64_t yPos{0};
+
+	while (true)
+	{
+		xPos += velocity.first;
+		yPos += velocity.second;
+
+		if (xPos > target.first.second)
+		{
+			return false;
+		}
+
+		if (yPos < target.second.first)
+		{
+			return false;
+		}
+
+		if (velocity.first != 0)
+		{
+			if (velocity.first > 0)
+			{
+				velocity.first -= 1;
+			}
+			else
+			{
+				velocity.first += 1;
+			}
+		}
+
+		velocity.second -= 1;
+
+		if ((xPos >= target.first.first)
+		    && (xPos <= target.first.second)
+		    && (yPos >= target.second.first)
+		    && (yPos <= target.second.second)
+				)
+		{
+			return true;
+		}
+	}
+}
+
+}
@@ -4,6 +4,8 @@
 
 #include "Node.hpp"
 
+namespace day18
+{
 
 Node::Node(const NodeOrientation &orientation, Node::NodeValue value)
 		: nodeOrientation(orientation), value(value)
@@ -257,7 +259,7 @@ std::unique_ptr<Node> Node::Copy()
 }
 
 
-std::unique_ptr<Node> NodeParser::Parse(const std::string &nodeStr)
+std::unique_ptr<Node> NodeParser::Parse(std::string_view nodeStr)
 {
 	position = nodeStr.begin();
 
@@ -302,4 +304,4 @@ std::unique_ptr<Node> NodeParser::ParseNode(const NodeOrientation &orientation,
 	return result;
 }
 
-
+}
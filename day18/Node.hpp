@@ -9,6 +9,10 @@
 #include <utility>
 #include <cstdint>
 #include <memory>
+#include <string_view>
+
+namespace day18
+{
 
 enum class NodeOrientation
 {
@@ -68,13 +72,15 @@ class NodeParser
 {
 public:
 
-	std::unique_ptr<Node> Parse(const std::string &nodeStr);
+	std::unique_ptr<Node> Parse(std::string_view nodeStr);
 
 private:
 	std::unique_ptr<Node> ParseNode(const NodeOrientation &orientation, Node *parent);
 
 private:
-	std::string::const_iterator position;
+	std::string_view::const_iterator position;
 };
 
+}
+
 #endif //ADVENTOFCODE2021_NODE_HPP
@@ -0,0 +1,111 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <vector>
+
+#include "Node.hpp"
+
+namespace day18
+{
+
+std::vector<std::unique_ptr<Node>> ParseInput(const std::vector<std::string_view> &lines);
+std::uint64_t SolvePart1(const std::vector<std::unique_ptr<Node>> &nodes);
+std::uint64_t SolvePart2(const std::vector<std::unique_ptr<Node>> &nodes);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::vector<std::unique_ptr<Node>> ParseInput(const std::vector<std::string_view> &lines)
+{
+	std::vector<std::unique_ptr<Node>> result {};
+	result.reserve(lines.size());
+
+	NodeParser parser {};
+	for (const auto &line: lines)
+	{
+		result.push_back(parser.Parse(line));
+	}
+
+	return result;
+}
+
+std::uint64_t SolvePart1(const std::vector<std::unique_ptr<Node>> &nodes)
+{
+	auto node = nodes.front()->Copy();
+
+
+	for (auto it = std::next(nodes.cbegin(), 1); it != nodes.cend(); std::advance(it, 1))
+	{
+		auto newNode = std::make_unique<Node>(NodeOrientation::Top, std::make_pair(nullptr, nullptr));
+		node->SetParent(newNode.get());
+		node->SetOrientation(NodeOrientation::Left);
+
+		auto addNode = (*it)->Copy();
+		addNode->SetParent(newNode.get());
+		addNode->SetOrientation(NodeOrientation::Right);
+
+		newNode->SetNested(std::make_pair(std::move(node), std::move(addNode)));
+
+		node = std::move(newNode);
+		node->Reduce();
+	}
+
+	return node->GetMagnitude();
+}
+
+std::uint64_t SolvePart2(const std::vector<std::unique_ptr<Node>> &nodes)
+{
+	if (nodes.size() < 2)
+	{
+		throw std::runtime_error("Not enough numbers to add");
+	}
+
+	const auto max = [](std::uint64_t lhs, std::uint64_t rhs)
+	{
+		return std::max(lhs, rhs);
+	};
+
+	// Every left operand is one task, the copies make the additions independent of each other.
+	return ParallelReduce(0, nodes.size(), 1, std::uint64_t{0}, [&nodes](std::size_t i)
+	{
+		std::uint64_t best{0};
+		for (auto j = 0U; j < nodes.size(); ++j)
+		{
+			if (i == j)
+			{
+				continue;
+			}
+
+			auto newNode = std::make_unique<Node>(NodeOrientation::Top, std::make_pair(nullptr, nullptr));
+
+			auto lNode = nodes[i]->Copy();
+			lNode->SetParent(newNode.get());
+			lNode->SetOrientation(NodeOrientation::Left);
+
+			auto rNode = nodes[j]->Copy();
+			rNode->SetParent(newNode.get());
+			rNode->SetOrientation(NodeOrientation::Right);
+
+			newNode->SetNested(std::make_pair(std::move(lNode), std::move(rNode)));
+
+			newNode->Reduce();
+			best = std::max(best, newNode->GetMagnitude());
+		}
+		return best;
+	}, max);
+}
+
+}
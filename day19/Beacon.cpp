@@ -4,6 +4,9 @@
 
 #include "Beacon.hpp"
 
+namespace day19
+{
+
 Beacon Beacon::operator-(const Beacon &other) const
 {
 	return {x - other.x, y - other.y, z - other.z};
@@ -13,3 +16,5 @@ Beacon Beacon::operator+(const Beacon &other) const
 {
 	return {x + other.x, y + other.y, z + other.z};
 }
+
+}
@@ -5,6 +5,8 @@
 #include <optional>
 #include <tuple>
 
+namespace day19
+{
 
 using Offset = std::tuple<std::int32_t, std::int32_t, std::int32_t>;
 
@@ -17,5 +19,6 @@ struct Beacon
 	Beacon operator+(const Beacon &other) const;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_BEACON_HPP
@@ -1,6 +1,11 @@
 
 #include "Scanner.hpp"
 
+#include <algorithm>
+
+namespace day19
+{
+
 std::vector<Scanner> Scanner::GetAllRotations() const
 {
 	auto result = std::vector<Scanner> {};
@@ -95,3 +100,5 @@ Scanner Scanner::operator+(const Scanner &other) const
 	}
 	return result;
 }
+
+}
@@ -5,6 +5,9 @@
 #include <vector>
 #include <string>
 
+namespace day19
+{
+
 class Scanner
 {
 public:
@@ -20,5 +23,6 @@ public:
 	[[nodiscard]] Scanner OffsetScanner(const Offset &offset) const;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_SCANNER_HPP
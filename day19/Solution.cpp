@@ -0,0 +1,278 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "Instrumentation.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include "Beacon.hpp"
+#include "Scanner.hpp"
+
+namespace day19
+{
+
+std::vector<Scanner> ParseInput(const std::vector<std::string_view> &lines);
+std::vector<Scanner> UnpackInput(const PackedReader &reader);
+
+
+std::pair<Scanner, std::vector<Offset>> SolveIntermediate(const std::vector<Scanner> &scanners);
+
+std::uint64_t SolvePart1(const Scanner &referenceScanner);
+
+std::uint64_t SolvePart2(const std::vector<Offset> &offsets);
+
+
+std::optional<Offset> CompareTwoScanners(const Scanner &reference, const Scanner &candidate);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	struct State
+	{
+		std::vector<Scanner> input;
+		std::pair<Scanner, std::vector<Offset>> aligned;
+		std::uint64_t part1Result{};
+		std::uint64_t part2Result{};
+	};
+	auto state = std::make_shared<State>();
+
+	harness.AddPhase("Parse", [state](const InputFile &file)
+	{
+		state->input = IsPackedInput(file.Contents()) ? UnpackInput(PackedReader{file.Contents(), 19})
+		                                              : ParseInput(file.Lines());
+	});
+	harness.AddPhase("Align", [state](const InputFile &)
+	{
+		state->aligned = SolveIntermediate(state->input);
+	});
+	harness.AddPhase("Part 1", [state](const InputFile &)
+	{
+		state->part1Result = SolvePart1(state->aligned.first);
+	});
+	harness.AddPhase("Part 2", [state](const InputFile &)
+	{
+		state->part2Result = SolvePart2(state->aligned.second);
+	});
+	harness.AddResult("Part 1", [state]
+	{
+		return ResultToString(state->part1Result);
+	});
+	harness.AddResult("Part 2", [state]
+	{
+		return ResultToString(state->part2Result);
+	});
+}
+
+// Scanner names concatenated into a U8 column, U32 columns of name lengths and beacons per scanner, then
+// I32 columns of the x, y and z coordinates of all beacons in scanner order.
+std::string Pack(const InputFile &input)
+{
+	std::string names;
+	std::vector<std::uint32_t> nameLengths;
+	std::vector<std::uint32_t> beaconCounts;
+	std::array<std::vector<std::int32_t>, 3> coordinates;
+	for (const auto &scanner: ParseInput(input.Lines()))
+	{
+		names += scanner.name;
+		nameLengths.push_back(static_cast<std::uint32_t>(scanner.name.size()));
+		beaconCounts.push_back(static_cast<std::uint32_t>(scanner.beacons.size()));
+		for (const auto &beacon: scanner.beacons)
+		{
+			coordinates[0].push_back(beacon.x);
+			coordinates[1].push_back(beacon.y);
+			coordinates[2].push_back(beacon.z);
+		}
+	}
+
+	PackedWriter writer{19};
+	writer.AddString(names);
+	writer.AddArray<std::uint32_t>(nameLengths);
+	writer.AddArray<std::uint32_t>(beaconCounts);
+	for (const auto &column: coordinates)
+	{
+		writer.AddArray<std::int32_t>(column);
+	}
+	return writer.Finish();
+}
+
+std::vector<Scanner> UnpackInput(const PackedReader &reader)
+{
+	auto names = reader.String(0);
+	const auto nameLengths = reader.Array<std::uint32_t>(1);
+	const auto beaconCounts = reader.Array<std::uint32_t>(2);
+	const auto x = reader.Array<std::int32_t>(3);
+	const auto y = reader.Array<std::int32_t>(4);
+	const auto z = reader.Array<std::int32_t>(5);
+	if (beaconCounts.size() != nameLengths.size() || y.size() != x.size() || z.size() != x.size())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	std::vector<Scanner> result;
+	result.reserve(nameLengths.size());
+	std::size_t beacon = 0;
+	for (auto i = 0U; i < nameLengths.size(); ++i)
+	{
+		if (nameLengths[i] > names.size() || beaconCounts[i] > x.size() - beacon)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		Scanner scanner{std::string{names.substr(0, nameLengths[i])}, {}};
+		names.remove_prefix(nameLengths[i]);
+
+		scanner.beacons.reserve(beaconCounts[i]);
+		for (const auto end = beacon + beaconCounts[i]; beacon < end; ++beacon)
+		{
+			scanner.beacons.push_back(Beacon{x[beacon], y[beacon], z[beacon]});
+		}
+		result.push_back(std::move(scanner));
+	}
+	return result;
+}
+
+std::vector<Scanner> ParseInput(const std::vector<std::string_view> &lines)
+{
+	auto position = lines.cbegin();
+
+	std::vector<Scanner> result;
+	while (position != lines.end())
+	{
+		Scanner scanner{std::string{*position}, {}};
+		std::advance(position, 1); // skip scanner name
+
+		while (position != lines.end() && !position->empty())
+		{
+			const auto [x, y, z] = ParseIntegers<std::int32_t, 3>(SplitView{*position, ','});
+			scanner.beacons.push_back(Beacon{x, y, z});
+			std::advance(position, 1);
+		}
+		if (position != lines.end())
+		{
+			std::advance(position, 1); // skip empty line separating scanners
+		}
+		result.push_back(std::move(scanner));
+	}
+
+	return result;
+}
+
+std::pair<Scanner, std::vector<Offset>> SolveIntermediate(const std::vector<Scanner> &scanners)
+{
+	auto referenceScanner = scanners.front();
+	std::vector<Offset> offsets{{0, 0, 0}};
+	offsets.reserve(scanners.size());
+
+	struct Candidate
+	{
+		std::vector<Scanner> rotations;
+		std::optional<std::pair<Scanner, Offset>> match;
+	};
+
+	std::vector<Scanner> sortedScanners(std::next(scanners.begin(), 1), scanners.end());
+	std::sort(sortedScanners.begin(), sortedScanners.end());
+	std::vector<Candidate> unresolvedScanners;
+	for (const auto &scanner: sortedScanners)
+	{
+		unresolvedScanners.push_back({scanner.GetAllRotations(), std::nullopt});
+	}
+
+	while (!unresolvedScanners.empty())
+	{
+		// Every unresolved scanner is matched against the current reference independently, all matches
+		// of a round are merged afterwards in name order.
+		ParallelFor(0, unresolvedScanners.size(), 1, [&unresolvedScanners, &referenceScanner](std::size_t index)
+		{
+			auto &candidate = unresolvedScanners[index];
+			for (const auto &rotation: candidate.rotations)
+			{
+				if (const auto offset = CompareTwoScanners(referenceScanner, rotation); offset.has_value())
+				{
+					candidate.match = std::make_pair(rotation.OffsetScanner(offset.value()), offset.value());
+					return;
+				}
+			}
+		});
+
+		std::vector<Candidate> remaining;
+		for (auto &candidate: unresolvedScanners)
+		{
+			if (!candidate.match.has_value())
+			{
+				remaining.push_back(std::move(candidate));
+				continue;
+			}
+			referenceScanner = referenceScanner + candidate.match->first;
+			offsets.push_back(candidate.match->second);
+		}
+		if (remaining.size() == unresolvedScanners.size())
+		{
+			throw std::runtime_error("Unable to solve");
+		}
+		unresolvedScanners = std::move(remaining);
+	}
+
+	return std::make_pair(referenceScanner, std::move(offsets));
+}
+
+std::uint64_t SolvePart1(const Scanner &referenceScanner)
+{
+	return referenceScanner.beacons.size();
+}
+
+std::optional<Offset> CompareTwoScanners(const Scanner &reference, const Scanner &candidate)
+{
+	AOC_SCOPED_TIMER("day19.CompareTwoScanners");
+
+	for (const auto referenceBeacon: reference.beacons)
+	{
+		for (const auto candidateBeacon: candidate.beacons)
+		{
+			auto offsetCandidate = referenceBeacon - candidateBeacon;
+			AOC_COUNTER_INCREMENT("day19.offsets_tested");
+
+			auto matches = std::count_if(candidate.beacons.begin(), candidate.beacons.end(),
+			                             [&reference, &offsetCandidate](const Beacon &candidate)
+			                             {
+				                             return reference.Contains(candidate + offsetCandidate);
+			                             });
+
+			if (matches >= 12U)
+			{
+				AOC_COUNTER_INCREMENT("day19.scanners_matched");
+				return Offset{offsetCandidate.x, offsetCandidate.y, offsetCandidate.z};
+			}
+		}
+	}
+
+	return std::nullopt;
+}
+
+std::uint64_t SolvePart2(const std::vector<Offset> &offsets)
+{
+	std::set<std::uint64_t> distances;
+
+	for (auto source = offsets.begin(); source != offsets.end(); ++source)
+	{
+		for (auto destination = offsets.begin(); destination != offsets.end(); ++destination)
+		{
+			if (source != destination)
+			{
+				const auto manhattan = std::abs(std::get<0>(*destination) - std::get<0>(*source)) +
+				                       std::abs(std::get<1>(*destination) - std::get<1>(*source)) +
+				                       std::abs(std::get<2>(*destination) - std::get<2>(*source));
+				distances.emplace(manhattan);
+			}
+		}
+	}
+	return *distances.rbegin();
+}
+
+}
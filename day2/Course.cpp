@@ -0,0 +1,239 @@
+#include "Course.hpp"
+#include "shared.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace day2
+{
+
+namespace
+{
+	constexpr std::size_t GroupSize = 4;
+
+	// Per opcode, how much of the argument goes into the position and into the aim. Opcode 3 is never
+	// stored and does nothing.
+	constexpr std::array<std::int64_t, 4> ForwardFactor{1, 0, 0, 0};
+	constexpr std::array<std::int64_t, 4> AimFactor{0, 1, -1, 0};
+
+	// Runs whole groups [first, last), each group is the four commands of one opcode byte.
+	using GroupFunction = CourseState (*)(const std::uint8_t *opcodes, const std::uint16_t *arguments,
+	                                      std::size_t first, std::size_t last, CourseState state);
+
+	unsigned OpcodeBits(const std::uint8_t *opcodes, std::size_t index)
+	{
+		return opcodes[index / GroupSize] >> (index % GroupSize * 2) & 3;
+	}
+
+	CourseState StepScalar(const std::uint8_t *opcodes, const std::uint16_t *arguments, std::size_t first,
+	                       std::size_t last, CourseState state)
+	{
+		for (auto i = first; i < last; ++i)
+		{
+			const auto opcode = OpcodeBits(opcodes, i);
+			const auto forward = arguments[i] * ForwardFactor[opcode];
+			state.position += forward;
+			state.depth += state.aim * forward;
+			state.aim += arguments[i] * AimFactor[opcode];
+		}
+		return state;
+	}
+
+	CourseState GroupsScalar(const std::uint8_t *opcodes, const std::uint16_t *arguments, std::size_t first,
+	                         std::size_t last, CourseState state)
+	{
+		return StepScalar(opcodes, arguments, first * GroupSize, last * GroupSize, state);
+	}
+
+#ifdef AOC_X86_KERNELS
+	__attribute__((target("avx2")))
+	std::int64_t HorizontalSum(__m256i value)
+	{
+		alignas(32) std::int64_t lanes[4];
+		_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), value);
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+
+	// Low 64 bits of value * factor for factors below 2^32, which is the same in signed arithmetic.
+	__attribute__((target("avx2")))
+	__m256i MultiplyLow(__m256i value, __m256i factor)
+	{
+		const auto low = _mm256_mul_epu32(value, factor);
+		const auto high = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), factor);
+		return _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+	}
+
+	// One command per 64 bit lane. The aim before every lane is the carried aim plus an exclusive prefix
+	// sum of the aim changes within the group, so the four depth updates are independent.
+	__attribute__((target("avx2")))
+	CourseState GroupsAvx2(const std::uint8_t *opcodes, const std::uint16_t *arguments, std::size_t first,
+	                       std::size_t last, CourseState state)
+	{
+		const auto zero = _mm256_setzero_si256();
+		const auto shifts = _mm256_setr_epi64x(0, 2, 4, 6);
+		const auto mask = _mm256_set1_epi64x(3);
+		const auto down = _mm256_set1_epi64x(static_cast<std::int64_t>(Opcode::Down));
+		const auto up = _mm256_set1_epi64x(static_cast<std::int64_t>(Opcode::Up));
+
+		auto position = zero;
+		auto depth = zero;
+		auto aim = _mm256_set1_epi64x(state.aim);
+		for (auto group = first; group < last; ++group)
+		{
+			const auto codes = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(opcodes[group]), shifts), mask);
+			const auto values = _mm256_cvtepu16_epi64(
+					_mm_loadl_epi64(reinterpret_cast<const __m128i *>(arguments + group * GroupSize)));
+
+			const auto forward = _mm256_and_si256(values, _mm256_cmpeq_epi64(codes, zero));
+			const auto change = _mm256_sub_epi64(_mm256_and_si256(values, _mm256_cmpeq_epi64(codes, down)),
+			                                     _mm256_and_si256(values, _mm256_cmpeq_epi64(codes, up)));
+
+			auto prefix = _mm256_add_epi64(change, _mm256_blend_epi32(
+					_mm256_permute4x64_epi64(change, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x03));
+			prefix = _mm256_add_epi64(prefix, _mm256_blend_epi32(
+					_mm256_permute4x64_epi64(prefix, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x0f));
+
+			const auto laneAim = _mm256_add_epi64(aim, _mm256_sub_epi64(prefix, change));
+			position = _mm256_add_epi64(position, forward);
+			depth = _mm256_add_epi64(depth, MultiplyLow(laneAim, forward));
+			aim = _mm256_add_epi64(aim, _mm256_permute4x64_epi64(prefix, _MM_SHUFFLE(3, 3, 3, 3)));
+		}
+
+		state.position += HorizontalSum(position);
+		state.depth += HorizontalSum(depth);
+		state.aim = _mm256_extract_epi64(aim, 0);
+		return state;
+	}
+#endif
+
+	std::pair<GroupFunction, std::string_view> SelectKernel()
+	{
+#ifdef AOC_X86_KERNELS
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {GroupsAvx2, "avx2"};
+		}
+#endif
+		return {GroupsScalar, "scalar"};
+	}
+
+	const std::pair<GroupFunction, std::string_view> &Kernel()
+	{
+		static const auto kernel = SelectKernel();
+		return kernel;
+	}
+
+	std::pair<Opcode, std::size_t> ParseCommand(std::string_view line)
+	{
+		constexpr std::array<std::pair<std::string_view, Opcode>, 3> Commands{{
+				{"forward ", Opcode::Forward}, {"down ", Opcode::Down}, {"up ", Opcode::Up}
+		}};
+		for (const auto &[command, opcode]: Commands)
+		{
+			if (line.starts_with(command))
+			{
+				return {opcode, command.size()};
+			}
+		}
+		throw std::runtime_error("Invalid command");
+	}
+}
+
+void Course::Add(Opcode opcode, std::uint16_t argument)
+{
+	const auto index = _arguments.size();
+	if (index % GroupSize == 0)
+	{
+		_opcodes.push_back(0);
+	}
+	_opcodes.back() |= static_cast<std::uint8_t>(static_cast<unsigned>(opcode) << (index % GroupSize * 2));
+	_arguments.push_back(argument);
+}
+
+std::size_t Course::Size() const
+{
+	return _arguments.size();
+}
+
+Opcode Course::OpcodeAt(std::size_t index) const
+{
+	return static_cast<Opcode>(OpcodeBits(_opcodes.data(), index));
+}
+
+const std::vector<std::uint8_t> &Course::Opcodes() const
+{
+	return _opcodes;
+}
+
+const std::vector<std::uint16_t> &Course::Arguments() const
+{
+	return _arguments;
+}
+
+Course ParseCourse(std::string_view contents)
+{
+	Course course;
+	std::size_t start = 0;
+	while (start < contents.size())
+	{
+		auto end = contents.find('\n', start);
+		if (end == std::string_view::npos)
+		{
+			end = contents.size();
+		}
+		auto line = contents.substr(start, end - start);
+		start = end + 1;
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.remove_suffix(1);
+		}
+		if (line.empty())
+		{
+			continue;
+		}
+
+		const auto [opcode, length] = ParseCommand(line);
+		course.Add(opcode, StrToInteger<std::uint16_t>(line.substr(length)));
+	}
+	return course;
+}
+
+CourseState Evaluate(const Course &course, std::size_t begin, std::size_t end, CourseState state)
+{
+	const auto *opcodes = course.Opcodes().data();
+	const auto *arguments = course.Arguments().data();
+	if (end <= begin)
+	{
+		return state;
+	}
+
+	// Commands before the first and after the last whole opcode byte go through the scalar step.
+	const auto firstGroup = (begin + GroupSize - 1) / GroupSize;
+	const auto lastGroup = end / GroupSize;
+	if (firstGroup >= lastGroup)
+	{
+		return StepScalar(opcodes, arguments, begin, end, state);
+	}
+	state = StepScalar(opcodes, arguments, begin, firstGroup * GroupSize, state);
+	state = Kernel().first(opcodes, arguments, firstGroup, lastGroup, state);
+	return StepScalar(opcodes, arguments, lastGroup * GroupSize, end, state);
+}
+
+CourseState Evaluate(const Course &course)
+{
+	return Evaluate(course, 0, course.Size());
+}
+
+std::string_view CourseKernel()
+{
+	return Kernel().second;
+}
+
+}
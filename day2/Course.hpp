@@ -0,0 +1,57 @@
+#ifndef ADVENTOFCODE2021_COURSE_HPP
+#define ADVENTOFCODE2021_COURSE_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace day2
+{
+
+enum class Opcode : std::uint8_t
+{
+	Forward = 0,
+	Down = 1,
+	Up = 2,
+};
+
+// Submarine state after a run of commands. Part 1 depth moves exactly like part 2 aim, so this is the
+// state of both parts.
+struct CourseState
+{
+	std::int64_t position = 0;
+	std::int64_t depth = 0;
+	std::int64_t aim = 0;
+};
+
+// The planned course as a struct of arrays: 2 bit opcodes packed four to a byte, lowest bits first,
+// next to the arguments.
+class Course
+{
+public:
+	void Add(Opcode opcode, std::uint16_t argument);
+
+	[[nodiscard]] std::size_t Size() const;
+	[[nodiscard]] Opcode OpcodeAt(std::size_t index) const;
+	[[nodiscard]] const std::vector<std::uint8_t> &Opcodes() const;
+	[[nodiscard]] const std::vector<std::uint16_t> &Arguments() const;
+
+private:
+	std::vector<std::uint8_t> _opcodes;
+	std::vector<std::uint16_t> _arguments;
+};
+
+// Lines of "forward N", "down N" or "up N".
+[[nodiscard]] Course ParseCourse(std::string_view contents);
+
+// Runs commands [begin, end) from the given state without branching on the opcodes. Four commands at a
+// time with AVX2 when the CPU supports it.
+[[nodiscard]] CourseState Evaluate(const Course &course, std::size_t begin, std::size_t end, CourseState state = {});
+[[nodiscard]] CourseState Evaluate(const Course &course);
+
+// Name of the evaluation kernel picked for this CPU ("avx2" or "scalar").
+[[nodiscard]] std::string_view CourseKernel();
+
+}
+
+#endif //ADVENTOFCODE2021_COURSE_HPP
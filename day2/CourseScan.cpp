@@ -0,0 +1,83 @@
+#include "CourseScan.hpp"
+#include "Parallel.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace day2
+{
+
+namespace
+{
+	// Commands evaluated by one task of EvaluateParallel.
+	constexpr std::size_t EvaluateBlockSize = std::size_t{1} << 16;
+
+	std::size_t BlockCount(std::size_t size, std::size_t blockSize)
+	{
+		return (size + blockSize - 1) / blockSize;
+	}
+
+	// Zero based state of every block, evaluated concurrently.
+	std::vector<CourseState> EvaluateBlocks(const Course &course, ThreadPool &pool, std::size_t blockSize)
+	{
+		return ParallelMap(pool, 0, BlockCount(course.Size(), blockSize), 1, [&course, blockSize](std::size_t block)
+		{
+			const auto begin = block * blockSize;
+			return Evaluate(course, begin, std::min(course.Size(), begin + blockSize));
+		});
+	}
+}
+
+CourseState Compose(const CourseState &state, const CourseState &segment)
+{
+	return {state.position + segment.position,
+	        state.depth + segment.depth + state.aim * segment.position,
+	        state.aim + segment.aim};
+}
+
+CourseState EvaluateParallel(const Course &course, ThreadPool &pool)
+{
+	return ParallelReduce(pool, 0, BlockCount(course.Size(), EvaluateBlockSize), 1, CourseState{},
+	                      [&course](std::size_t block)
+	                      {
+		                      const auto begin = block * EvaluateBlockSize;
+		                      return Evaluate(course, begin, std::min(course.Size(), begin + EvaluateBlockSize));
+	                      },
+	                      Compose);
+}
+
+CourseScan::CourseScan(Course course, ThreadPool &pool, std::size_t blockSize)
+		: _course(std::move(course)), _blockSize(blockSize)
+{
+	if (blockSize == 0)
+	{
+		throw std::runtime_error("Invalid block size");
+	}
+
+	// Blocks are independent, only the exclusive scan over their results is sequential and it touches
+	// one state per block.
+	const auto blocks = EvaluateBlocks(_course, pool, blockSize);
+	_starts.reserve(blocks.size() + 1);
+	_starts.emplace_back();
+	for (const auto &block: blocks)
+	{
+		_starts.push_back(Compose(_starts.back(), block));
+	}
+}
+
+CourseState CourseScan::At(std::size_t count) const
+{
+	if (count > _course.Size())
+	{
+		throw std::runtime_error("Step beyond the end of the course");
+	}
+	const auto block = count / _blockSize;
+	return Evaluate(_course, block * _blockSize, count, _starts[block]);
+}
+
+CourseState CourseScan::Total() const
+{
+	return _starts.back();
+}
+
+}
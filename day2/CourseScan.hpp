@@ -0,0 +1,45 @@
+#ifndef ADVENTOFCODE2021_COURSESCAN_HPP
+#define ADVENTOFCODE2021_COURSESCAN_HPP
+
+#include "Course.hpp"
+
+#include <vector>
+
+class ThreadPool;
+
+namespace day2
+{
+
+// Every run of commands is an affine map of the state: starting from (position, depth, aim) it ends at
+// (position + P, depth + D + aim * P, aim + A), where (P, D, A) is the state the run reaches from zero.
+// Returns the state after running segment, given as that zero based state, from state.
+// Associative, so runs can be evaluated separately and composed in order.
+[[nodiscard]] CourseState Compose(const CourseState &state, const CourseState &segment);
+
+// Whole course evaluated in blocks on the pool, the block results are composed in order.
+[[nodiscard]] CourseState EvaluateParallel(const Course &course, ThreadPool &pool);
+
+// Prefix states of a recorded course for random access: the state at the start of every block is
+// computed once with a parallel scan, a query then only runs the commands inside one block.
+// Owns its course, queries replay its commands.
+class CourseScan
+{
+public:
+	static constexpr std::size_t DefaultBlockSize = 4096;
+
+	CourseScan(Course course, ThreadPool &pool, std::size_t blockSize = DefaultBlockSize);
+
+	// State after the first count commands, throws if count is beyond the end of the course.
+	[[nodiscard]] CourseState At(std::size_t count) const;
+	[[nodiscard]] CourseState Total() const;
+
+private:
+	Course _course;
+	std::size_t _blockSize;
+	// State before every block, followed by the state at the end of the course.
+	std::vector<CourseState> _starts;
+};
+
+}
+
+#endif //ADVENTOFCODE2021_COURSESCAN_HPP
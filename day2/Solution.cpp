@@ -0,0 +1,84 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Course.hpp"
+#include "CourseScan.hpp"
+#include "ThreadPool.hpp"
+#include <iostream>
+
+namespace day2
+{
+
+std::int64_t SolvePart1(const CourseState &state);
+std::int64_t SolvePart2(const CourseState &state);
+
+// Fold for --stream runs, tracks both parts at once.
+class CourseFold
+{
+public:
+	void Consume(std::string_view line)
+	{
+		const auto [command, value] = SplitTokens<2>(SplitView{line});
+		const auto argument = static_cast<std::int64_t>(StrToInteger<std::uint16_t>(value));
+		switch (command.front())
+		{
+			case 'f':
+				_position += argument;
+				_depth += _aim * argument;
+				break;
+			case 'u':
+				_aim -= argument;
+				break;
+			case 'd':
+				_aim += argument;
+				break;
+			default:
+				throw std::runtime_error("Invalid command");
+		}
+	}
+
+	[[nodiscard]] std::int64_t Part1() const
+	{
+		// Part 1 depth moves exactly like part 2 aim.
+		return _position * _aim;
+	}
+
+	[[nodiscard]] std::int64_t Part2() const
+	{
+		return _position * _depth;
+	}
+
+private:
+	std::int64_t _position = 0;
+	std::int64_t _depth = 0;
+	std::int64_t _aim = 0;
+};
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 // Both parts read the same final state, the course is only evaluated once.
+		                 return EvaluateParallel(ParseCourse(file.Contents()), DefaultPool());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+	RegisterStreamingFold<CourseFold>(harness);
+}
+
+std::int64_t SolvePart1(const CourseState &state)
+{
+	// Part 1 depth moves exactly like part 2 aim.
+	return state.position * state.aim;
+}
+
+std::int64_t SolvePart2(const CourseState &state)
+{
+	return state.position * state.depth;
+}
+
+}
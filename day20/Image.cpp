@@ -1,109 +1,84 @@
 #include "Image.hpp"
 
 #include <utility>
-#include <bitset>
 
-Image::Image(std::vector<bool> pixels, size_t width, size_t height)
-		: pixels(std::move(pixels)), width(width), height(height)
-{}
+namespace day20
+{
 
-void Image::Pad(std::size_t size)
+namespace
 {
-	const std::size_t newWidth = width + (2 * size), newHeight = height + (2 * size);
 
-	std::vector<bool> newPixels(newWidth * newHeight, false);
-	for (auto i = 0U; i < height; ++i)
+Grid2D<std::uint8_t> Pad(const Grid2D<std::uint8_t> &source, std::size_t size)
+{
+	Grid2D<std::uint8_t> result{source.Width() + 2 * size, source.Height() + 2 * size, 1};
+	for (auto y = 0U; y < source.Height(); ++y)
 	{
-		const auto source = std::next(pixels.begin(), i * width);
-		const auto destination = std::next(newPixels.begin(), (i + size) * newWidth + size);
-		std::copy_n(source, width, destination);
+		for (auto x = 0U; x < source.Width(); ++x)
+		{
+			result(x + size, y + size) = source(x, y);
+		}
 	}
+	return result;
+}
 
-	width = newWidth;
-	height = newHeight;
-	pixels = std::move(newPixels);
 }
 
+Image::Image(Grid2D<std::uint8_t> pixels, std::size_t steps)
+		: pixels(Pad(pixels, steps))
+{}
+
 std::ostream &operator<<(std::ostream &os, const Image &image)
 {
-	for (auto y = 0U; y < image.height; ++y)
+	const auto &pixels = image.pixels.Current();
+	for (auto y = 0U; y < pixels.Height(); ++y)
 	{
-		for (auto x = 0U; x < image.width; ++x)
+		for (auto x = 0U; x < pixels.Width(); ++x)
 		{
-			os << (image.pixels[y * image.width + x] ? '#' : '.');
+			os << (pixels(x, y) ? '#' : '.');
 		}
 		os << "\r\n";
 	}
 	return os;
 }
 
-std::array<Image::Position, 9U> Image::GetSquare(const Image::Position &currentPosition)
-{
-	static constinit const std::array<Position, 9U> steps =
-			{
-					std::make_pair(-1, -1),
-					std::make_pair(0, -1),
-					std::make_pair(1, -1),
-					std::make_pair(-1, 0),
-					std::make_pair(0, 0),
-					std::make_pair(1, 0),
-					std::make_pair(-1, 1),
-					std::make_pair(0, 1),
-					std::make_pair(1, 1),
-			};
-
-	std::array<Position, 9U> result{};
-
-	for (auto i = 0U; i < 9; ++i)
-	{
-		result[i] = {currentPosition.first + steps[i].first, currentPosition.second + steps[i].second};
-	}
-
-	return result;
-}
-
 void Image::Enhance(const Algorithm &algo)
 {
-	auto newPixels = pixels;
+	const auto &current = pixels.Current();
+	auto &next = pixels.Next();
+	const auto offsets = current.Offsets(Square3x3);
 
-	for (auto y = 1U; y < height - 1; ++y)
+	for (auto y = 0U; y < current.Height(); ++y)
 	{
-		for (auto x = 1U; x < width - 1; ++x)
+		auto index = current.Index(0, y);
+		for (auto x = 0U; x < current.Width(); ++x, ++index)
 		{
-			const auto positions = GetSquare({x, y});
-
-			std::bitset<9U> bits {};
-			for (auto i = 0U; i < bits.size(); ++i)
+			std::size_t algoIndex{};
+			for (const auto offset: offsets)
 			{
-				bits[bits.size() - 1 - i] = pixels[positions[i].second * width + positions[i].first];
+				algoIndex = (algoIndex << 1) | current[index + offset];
 			}
-			const auto algoIndex = bits.to_ulong();
-			newPixels[y * width + x] = algo[algoIndex];
+			next[index] = algo[algoIndex];
 		}
 	}
 
-	pixels = std::move(newPixels);
+	background = algo[background ? 511 : 0];
+	next.FillBorder(background);
+	pixels.Flip();
 }
 
 std::uint64_t Image::Count() const
 {
-	return std::count(pixels.begin(), pixels.end(), true);
-}
-
-void Image::Strip(std::size_t size)
-{
-	const std::size_t newWidth = width - (2 * size), newHeight = height - (2 * size);
-
-	std::vector<bool> newPixels {};
-	newPixels.reserve(newWidth * newHeight);
-
-	for (auto y = size; y <= height - size; ++y)
+	const auto &current = pixels.Current();
+	std::uint64_t result{};
+	for (auto y = 0U; y < current.Height(); ++y)
 	{
-		const auto source = std::next(pixels.begin(), y * width + size);
-		std::copy_n(source, newWidth, std::back_inserter(newPixels));
+		auto index = current.Index(0, y);
+		for (auto x = 0U; x < current.Width(); ++x, ++index)
+		{
+			result += current[index];
+		}
 	}
+	return result;
+}
 
-	width = newWidth;
-	height = newHeight;
-	pixels = std::move(newPixels);
 }
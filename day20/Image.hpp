@@ -1,34 +1,36 @@
 #ifndef ADVENTOFCODE2021_IMAGE_HPP
 #define ADVENTOFCODE2021_IMAGE_HPP
 
+#include "Grid2D.hpp"
 #include <cstdint>
-#include <vector>
 #include <ostream>
 #include <array>
 
+namespace day20
+{
+
 using Algorithm = std::array<bool, 512>;
+
+// The infinite image is the grid plus a background value for everything outside of it. The grid is
+// allocated large enough for all enhancements up front and the border holds the background.
 class Image
 {
 public:
-	Image(std::vector<bool> pixels, size_t width, size_t height);
+	Image(Grid2D<std::uint8_t> pixels, std::size_t steps);
 
-	void Pad(std::size_t size);
-	void Strip(std::size_t size);
 	void Enhance(const Algorithm &algo);
 	std::uint64_t Count() const;
 
 private:
-	using Position = std::pair<std::size_t, std::size_t>;
 	friend std::ostream &operator<<(std::ostream &os, const Image &image);
-	std::array<Image::Position, 9U> GetSquare(const Position &currentPosition);
 
 private:
-	std::vector<bool> pixels;
-	std::size_t width;
-	std::size_t height;
+	DoubleBuffered<Grid2D<std::uint8_t>> pixels;
+	std::uint8_t background = 0;
 };
 
 std::ostream &operator<<(std::ostream &os, const Image &image);
 
+}
 
 #endif //ADVENTOFCODE2021_IMAGE_HPP
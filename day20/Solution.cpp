@@ -0,0 +1,174 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include <iostream>
+#include <vector>
+#include <functional>
+
+#include "Image.hpp"
+
+namespace day20
+{
+
+std::pair<Algorithm, Grid2D<std::uint8_t>> ParseInput(const std::vector<std::string_view> &lines);
+std::pair<Algorithm, Grid2D<std::uint8_t>> UnpackInput(const PackedReader &reader);
+
+std::uint64_t SolvePart1(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels);
+std::uint64_t SolvePart2(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels);
+std::uint64_t Enhance(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels, std::size_t steps);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return UnpackInput(PackedReader{file.Contents(), 20});
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart1(input.first, input.second);
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart2(input.first, input.second);
+	                 });
+}
+
+// The algorithm as 512 bits, the image shape as a {width, height} U32 column and the pixels as bits.
+std::string Pack(const InputFile &input)
+{
+	const auto [algorithm, pixels] = ParseInput(input.Lines());
+	std::vector<std::uint8_t> cells;
+	cells.reserve(pixels.Width() * pixels.Height());
+	for (auto y = 0U; y < pixels.Height(); ++y)
+	{
+		for (auto x = 0U; x < pixels.Width(); ++x)
+		{
+			cells.push_back(pixels(x, y));
+		}
+	}
+
+	PackedWriter writer{20};
+	writer.AddBits(std::vector<std::uint8_t>(algorithm.begin(), algorithm.end()));
+	const std::array<std::uint32_t, 2> shape{static_cast<std::uint32_t>(pixels.Width()),
+	                                         static_cast<std::uint32_t>(pixels.Height())};
+	writer.AddArray<std::uint32_t>(shape);
+	writer.AddBits(cells);
+	return writer.Finish();
+}
+
+std::pair<Algorithm, Grid2D<std::uint8_t>> UnpackInput(const PackedReader &reader)
+{
+	const auto bits = reader.Bits(0);
+	const auto shape = reader.Array<std::uint32_t>(1);
+	if (bits.size() != 512 || shape.size() != 2 || reader.Count(2) != std::size_t{shape[0]} * shape[1])
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	Algorithm algorithm{};
+	std::copy(bits.begin(), bits.end(), algorithm.begin());
+
+	const auto *cells = reinterpret_cast<const std::uint8_t *>(reader.Bytes(2, PackedType::Bits).data());
+	Grid2D<std::uint8_t> pixels{shape[0], shape[1]};
+	std::size_t cell = 0;
+	for (auto y = 0U; y < pixels.Height(); ++y)
+	{
+		// Bit by bit up to a byte boundary, then eight pixels per byte.
+		auto *row = &pixels(0, y);
+		std::size_t x = 0;
+		for (; x < pixels.Width() && (cell + x) % 8 != 0; ++x)
+		{
+			row[x] = cells[(cell + x) / 8] >> ((cell + x) % 8) & 1;
+		}
+		for (; x + 8 <= pixels.Width(); x += 8)
+		{
+			const auto bits = cells[(cell + x) / 8];
+			for (auto bit = 0U; bit < 8; ++bit)
+			{
+				row[x + bit] = bits >> bit & 1;
+			}
+		}
+		for (; x < pixels.Width(); ++x)
+		{
+			row[x] = cells[(cell + x) / 8] >> ((cell + x) % 8) & 1;
+		}
+		cell += pixels.Width();
+	}
+	return std::make_pair(algorithm, std::move(pixels));
+}
+
+
+std::pair<Algorithm, Grid2D<std::uint8_t>> ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.front().size() != 512)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+
+	Algorithm algorithm {};
+	for (auto i = 0U; i < 512; ++i)
+	{
+		if (lines.front()[i] == '#')
+		{
+			algorithm[i] = true;
+		}
+	}
+
+	if (!lines[1].empty())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	const std::size_t width = lines[2].length();
+	Grid2D<std::uint8_t> pixels{width, lines.size() - 2};
+
+	for (auto y = 0U; y < pixels.Height(); ++y)
+	{
+		const auto &line = lines[y + 2];
+		if (line.length() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		for (auto x = 0U; x < width; ++x)
+		{
+			pixels(x, y) = line[x] == '#';
+		}
+	}
+
+	return std::make_pair(algorithm, std::move(pixels));
+}
+
+std::uint64_t SolvePart1(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels)
+{
+	return Enhance(algo, pixels, 2);
+}
+
+std::uint64_t SolvePart2(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels)
+{
+	return Enhance(algo, pixels, 50);
+}
+
+std::uint64_t Enhance(const Algorithm &algo, const Grid2D<std::uint8_t> &pixels, std::size_t steps)
+{
+	// Every step can only light pixels one further out, so the image grows by at most one per side.
+	Image image(pixels, steps);
+
+	for (auto i = 0U; i < steps; ++i)
+	{
+		image.Enhance(algo);
+	}
+
+	return image.Count();
+}
+
+}
@@ -0,0 +1,173 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Instrumentation.hpp"
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+
+namespace day21
+{
+
+struct Player
+{
+	std::uint8_t position;
+	std::uint16_t score;
+	std::strong_ordering operator<=>(const Player &) const = default;
+};
+
+
+
+std::pair<Player, Player> ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(std::pair<Player, Player> players);
+std::uint64_t SolvePart2(std::pair<Player, Player> players);
+
+// Wins per player from a given state, independent of the starting positions so it can outlive one input.
+using QuantumCache = std::map<std::pair<Player, Player>, std::pair<std::uint64_t, std::uint64_t>>;
+std::uint64_t SolvePart2(std::pair<Player, Player> players, QuantumCache &cache);
+std::pair<std::uint64_t, std::uint64_t> QuantumGame(std::pair<Player, Player> players, QuantumCache &cache);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	const auto parse = [](const InputFile &file)
+	{
+		return ParseInput(file.Lines());
+	};
+
+	auto *persistent = harness.Persistent();
+	if (persistent == nullptr)
+	{
+		RegisterSolution(harness, parse, SolvePart1, [](std::pair<Player, Player> players)
+		{
+			return SolvePart2(players);
+		});
+		return;
+	}
+
+	// Hosted by a long running process: keep the memo table warm between runs.
+	auto cache = persistent->Get<SharedMemo<QuantumCache>>("day21.QuantumCache");
+	RegisterSolution(harness, parse, SolvePart1, [cache](std::pair<Player, Player> players)
+	{
+		std::lock_guard lock(cache->mutex);
+		return SolvePart2(players, cache->table);
+	});
+}
+
+std::pair<Player, Player> ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.size() != 2)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	const auto p1Elems = SplitTokens<5>(SplitView{lines.front()});
+	const auto p2Elems = SplitTokens<5>(SplitView{lines.at(1)});
+
+
+	// subtract one from positions to make them 0 based
+	Player p1{
+			static_cast<uint8_t>(StrToInteger<std::uint8_t>(p1Elems.back()) - 1),
+			0
+	};
+
+	Player p2{
+			static_cast<uint8_t>(StrToInteger<std::uint8_t>(p2Elems.back()) - 1),
+			0
+	};
+
+	return {p1, p2};
+};
+
+std::uint64_t SolvePart1(std::pair<Player, Player> players)
+{
+	std::uint16_t rolls{};
+
+	auto die = [die = std::uint8_t{1}]() mutable
+	{
+		if (die == 100)
+		{
+			die = 1;
+			return static_cast<std::uint8_t>(100U);
+		}
+		else
+		{
+			return die++;
+		}
+	};
+
+	auto p1Turn = true;
+	while (players.first.score < 1000 && players.second.score < 1000)
+	{
+		auto &currentPlayer = p1Turn ? players.first : players.second;
+		auto move = die() + die() + die();
+		rolls += 3;
+
+		currentPlayer.position = (currentPlayer.position + move) % 10;
+		currentPlayer.score += (currentPlayer.position + 1);
+		p1Turn = !p1Turn;
+	}
+
+	const auto &losingPlayer = p1Turn ? players.first : players.second;
+	return losingPlayer.score * rolls;
+}
+
+std::uint64_t SolvePart2(std::pair<Player, Player> players)
+{
+	QuantumCache quantumCache;
+	return SolvePart2(players, quantumCache);
+}
+
+std::uint64_t SolvePart2(std::pair<Player, Player> players, QuantumCache &cache)
+{
+	const auto &[p1, p2] = QuantumGame(players, cache);
+	return std::max(p1, p2);
+}
+
+std::pair<std::uint64_t, std::uint64_t> QuantumGame(std::pair<Player, Player> players, QuantumCache &cache)
+{
+	if (players.first.score >= 21)
+	{
+		return {1, 0};
+	}
+	else if (players.second.score >= 21)
+	{
+		return {0, 1};
+	}
+	else if (cache.contains(players))
+	{
+		AOC_COUNTER_INCREMENT("day21.cache_hits");
+		return cache.at(players);
+	}
+	AOC_COUNTER_INCREMENT("day21.cache_misses");
+
+	std::pair<std::uint64_t, std::uint64_t> result {0, 0};
+
+	for (auto die1 = 1U; die1 <= 3U; ++die1)
+	{
+		for (auto die2 = 1U; die2 <= 3U; ++die2)
+		{
+			for (auto die3 = 1U; die3 <= 3U; ++die3)
+			{
+				auto currentPlayer = players.first;
+				currentPlayer.position = (currentPlayer.position + die1 + die2 + die3) % 10;
+				currentPlayer.score += (currentPlayer.position + 1);
+
+				auto newPlayers = std::make_pair(players.second, currentPlayer);
+
+				const auto &[p2Wins, p1Wins] = QuantumGame(newPlayers, cache);
+				result.first += p1Wins;
+				result.second += p2Wins;
+			}
+		}
+	}
+
+	cache[players] = result;
+	return result;
+}
+
+}
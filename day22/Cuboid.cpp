@@ -6,6 +6,9 @@
 
 #include <algorithm>
 
+namespace day22
+{
+
 Cuboid::Cuboid(std::pair<std::int64_t, std::int64_t> x, std::pair<std::int64_t, std::int64_t> y,
                std::pair<std::int64_t, std::int64_t> z) : x(std::move(x)), y(std::move(y)), z(std::move(z))
 {
@@ -166,3 +169,5 @@ std::uint64_t Cuboid::Count() const noexcept
 {
 	return (x.second - x.first + 1) * (y.second - y.first + 1) * (z.second - z.first + 1);
 }
+
+}
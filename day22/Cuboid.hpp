@@ -11,6 +11,9 @@
 #include <optional>
 #include <vector>
 
+namespace day22
+{
+
 class Cuboid
 {
 public:
@@ -34,5 +37,6 @@ private:
 	std::pair<std::int64_t, std::int64_t> z;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_CUBOID_HPP
@@ -0,0 +1,190 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <map>
+#include "Cuboid.hpp"
+
+namespace day22
+{
+
+using Rule = std::pair<Cuboid, bool>;
+// Inclusive x, y and z ranges of a reboot step.
+using Bounds = std::array<std::pair<std::int64_t, std::int64_t>, 3>;
+
+std::vector<Rule> ParseInput(const std::vector<std::string_view> &lines);
+std::vector<Rule> UnpackInput(const PackedReader &reader);
+Rule ParseRule(std::string_view line);
+std::pair<Bounds, bool> ParseBounds(std::string_view line);
+std::uint64_t SolvePart1(const std::vector<Rule> &rules);
+std::uint64_t SolvePart2(const std::vector<Rule> &rules);
+
+std::pair<std::int64_t, std::int64_t> ParseCoords(std::string_view str);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return UnpackInput(PackedReader{file.Contents(), 22});
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+// A U8 column of on flags followed by I32 columns x from, x to, y from, y to, z from and z to.
+std::string Pack(const InputFile &input)
+{
+	std::vector<std::uint8_t> on;
+	std::array<std::vector<std::int32_t>, 6> columns;
+	for (const auto &line: input.Lines())
+	{
+		const auto [bounds, command] = ParseBounds(line);
+		on.push_back(command);
+		for (auto axis = 0U; axis < bounds.size(); ++axis)
+		{
+			for (const auto value: {bounds[axis].first, bounds[axis].second})
+			{
+				if (value < std::numeric_limits<std::int32_t>::min() || value > std::numeric_limits<std::int32_t>::max())
+				{
+					throw std::runtime_error("Coordinate does not fit into a packed input");
+				}
+			}
+			columns[2 * axis].push_back(static_cast<std::int32_t>(bounds[axis].first));
+			columns[2 * axis + 1].push_back(static_cast<std::int32_t>(bounds[axis].second));
+		}
+	}
+
+	PackedWriter writer{22};
+	writer.AddArray<std::uint8_t>(on);
+	for (const auto &column: columns)
+	{
+		writer.AddArray<std::int32_t>(column);
+	}
+	return writer.Finish();
+}
+
+std::vector<Rule> UnpackInput(const PackedReader &reader)
+{
+	const auto on = reader.Array<std::uint8_t>(0);
+	std::array<std::span<const std::int32_t>, 6> columns;
+	for (auto i = 0U; i < columns.size(); ++i)
+	{
+		columns[i] = reader.Array<std::int32_t>(i + 1);
+		if (columns[i].size() != on.size())
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+	}
+
+	std::vector<Rule> result;
+	result.reserve(on.size());
+	for (auto i = 0U; i < on.size(); ++i)
+	{
+		result.emplace_back(Cuboid{{columns[0][i], columns[1][i]}, {columns[2][i], columns[3][i]}, {columns[4][i], columns[5][i]}},
+		                    on[i] != 0);
+	}
+	return result;
+}
+
+std::vector<Rule> ParseInput(const std::vector<std::string_view> &lines)
+{
+	// Reboot steps are independent of each other, chunks of them are parsed concurrently.
+	return ParallelMap(0, lines.size(), 1024, [&lines](std::size_t i)
+	{
+		return ParseRule(lines[i]);
+	});
+}
+
+Rule ParseRule(std::string_view line)
+{
+	const auto [bounds, command] = ParseBounds(line);
+	return {Cuboid{bounds[0], bounds[1], bounds[2]}, command};
+}
+
+std::pair<Bounds, bool> ParseBounds(std::string_view line)
+{
+	const auto elems = SplitTokens<2>(SplitView{line});
+	const auto coords = SplitTokens<3>(SplitView{elems[1], ','});
+
+	auto command = elems[0] == "on";
+
+	return {{ParseCoords(coords[0]), ParseCoords(coords[1]), ParseCoords(coords[2])}, command};
+}
+
+std::pair<std::int64_t, std::int64_t> ParseCoords(std::string_view str)
+{
+	const auto split1 = SplitTokens<2>(SplitView{str, '='});
+	const auto split2 = SplitTokens<3>(SplitView{split1[1], '.'});
+
+	return {StrToInteger<std::int64_t>(split2[0]), StrToInteger<std::int64_t>(split2[2])};
+}
+
+std::uint64_t SolvePart1(const std::vector<Rule> &rules)
+{
+	std::vector<Cuboid> active;
+
+	for(const auto &rule: rules)
+	{
+		if (!rule.first.IsSmall()) continue;
+
+		std::vector<Cuboid> newActive;
+		for (const auto &cub : active)
+		{
+			auto intersection = cub.RemoveIntersection(rule.first);
+			std::copy(intersection.begin(), intersection.end(), std::back_inserter(newActive));
+		}
+		if (rule.second)
+		{
+			newActive.push_back(rule.first);
+		}
+		active = newActive;
+	}
+
+	std::uint64_t result {};
+	for (const auto &cub: active)
+	{
+		result += cub.Count();
+	}
+	return result;
+}
+
+std::uint64_t SolvePart2(const std::vector<Rule> &rules)
+{
+	std::vector<Cuboid> active;
+
+	for(const auto &rule: rules)
+	{
+		std::vector<Cuboid> newActive;
+		for (const auto &cub : active)
+		{
+			auto intersection = cub.RemoveIntersection(rule.first);
+			std::copy(intersection.begin(), intersection.end(), std::back_inserter(newActive));
+		}
+		if (rule.second)
+		{
+			newActive.push_back(rule.first);
+		}
+		active = newActive;
+	}
+
+	std::uint64_t result {};
+	for (const auto &cub: active)
+	{
+		result += cub.Count();
+	}
+	return result;
+}
+
+}
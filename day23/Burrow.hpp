@@ -4,11 +4,16 @@
 
 #include <cstdint>
 #include <array>
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <utility>
 #include <stdexcept>
 #include <iostream>
+#include "Instrumentation.hpp"
+
+namespace day23
+{
 
 enum class Field
 {
@@ -25,11 +30,15 @@ class Burrow
 public:
 	explicit Burrow(std::array<std::array<char, N>, 4> initialState);
 
+	// Minimal cost to finish from a state, it does not depend on how the state was reached so a cache
+	// can be reused across inputs.
+	using BurrowCache = std::map<Burrow, std::uint64_t>;
+
 	[[nodiscard]] std::uint64_t Solve() const;
+	[[nodiscard]] std::uint64_t Solve(BurrowCache &cache) const;
 	std::strong_ordering operator<=>(const Burrow &other) const = default;
 
 private:
-	using BurrowCache = std::map<Burrow, std::uint64_t>;
 	[[nodiscard]] std::uint64_t SolveInternal(BurrowCache &cache) const;
 
 	[[nodiscard]] static std::array<Field, N> ParseFields(const std::array<char, N> &input);
@@ -76,7 +85,17 @@ template<std::size_t N>
 std::uint64_t Burrow<N>::Solve() const
 {
 	BurrowCache cache;
-	return SolveInternal(cache);
+	return Solve(cache);
+}
+
+template<std::size_t N>
+std::uint64_t Burrow<N>::Solve(BurrowCache &cache) const
+{
+	AOC_SCOPED_TIMER("day23.Solve");
+
+	const auto result = SolveInternal(cache);
+	AOC_HISTOGRAM_RECORD("day23.cache_size", cache.size());
+	return result;
 }
 
 template<std::size_t N>
@@ -297,8 +316,10 @@ std::uint64_t Burrow<N>::SolveInternal(Burrow::BurrowCache &cache) const
 
 	if(cache.contains(*this))
 	{
+		AOC_COUNTER_INCREMENT("day23.cache_hits");
 		return cache.at(*this);
 	}
+	AOC_COUNTER_INCREMENT("day23.states_expanded");
 
 	// Try to move from hallway
 	for (auto i = 0U; i < hallway.size(); ++i)
@@ -354,4 +375,6 @@ std::uint64_t Burrow<N>::SolveInternal(Burrow::BurrowCache &cache) const
 	return result;
 }
 
+}
+
 #endif //ADVENTOFCODE2021_BURROW_HPP
@@ -0,0 +1,107 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <vector>
+#include <map>
+#include <utility>
+#include "Burrow.hpp"
+
+namespace day23
+{
+
+std::array<std::pair<char, char>, 4> ParseInput(const std::vector<std::string_view> &lines);
+Burrow<2> Part1Burrow(const std::array<std::pair<char, char>, 4> &input);
+Burrow<4> Part2Burrow(const std::array<std::pair<char, char>, 4> &input);
+std::uint64_t SolvePart1(const std::array<std::pair<char, char>, 4> &input);
+std::uint64_t SolvePart2(const std::array<std::pair<char, char>, 4> &input);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	const auto parse = [](const InputFile &file)
+	{
+		return ParseInput(file.Lines());
+	};
+
+	auto *persistent = harness.Persistent();
+	if (persistent == nullptr)
+	{
+		RegisterSolution(harness, parse, SolvePart1, SolvePart2);
+		return;
+	}
+
+	// Hosted by a long running process: keep the memo tables warm between runs.
+	auto cache2 = persistent->Get<SharedMemo<Burrow<2>::BurrowCache>>("day23.BurrowCache2");
+	auto cache4 = persistent->Get<SharedMemo<Burrow<4>::BurrowCache>>("day23.BurrowCache4");
+	RegisterSolution(harness, parse,
+	                 [cache2](const std::array<std::pair<char, char>, 4> &input)
+	                 {
+		                 std::lock_guard lock(cache2->mutex);
+		                 return Part1Burrow(input).Solve(cache2->table);
+	                 },
+	                 [cache4](const std::array<std::pair<char, char>, 4> &input)
+	                 {
+		                 std::lock_guard lock(cache4->mutex);
+		                 return Part2Burrow(input).Solve(cache4->table);
+	                 });
+}
+
+std::array<std::pair<char, char>, 4> ParseInput(const std::vector<std::string_view> &lines)
+{
+
+	const auto topElements = SplitTokens<9>(SplitView{lines[2], '#'});
+	const auto bottomElements = SplitTokens<5>(SplitView{*SplitView{lines[3]}.begin(), '#'});
+
+	return {
+			std::make_pair(topElements[3].front(), bottomElements[1].front()),
+			std::make_pair(topElements[4].front(), bottomElements[2].front()),
+			std::make_pair(topElements[5].front(), bottomElements[3].front()),
+			std::make_pair(topElements[6].front(), bottomElements[4].front())
+	};
+}
+
+Burrow<2> Part1Burrow(const std::array<std::pair<char, char>, 4> &input)
+{
+	std::array<std::array<char, 2>, 4> initialState {};
+
+	for (auto i = 0U; i < 4; ++i)
+	{
+		initialState[i][0] = input[i].first;
+		initialState[i][1] = input[i].second;
+	}
+
+	return Burrow<2>(initialState);
+}
+
+Burrow<4> Part2Burrow(const std::array<std::pair<char, char>, 4> &input)
+{
+	std::array<std::array<char, 4>, 4> initialState {};
+
+	const std::array<char, 4> extra1 = {'D', 'C', 'B', 'A'};
+	const std::array<char, 4> extra2 = {'D', 'B', 'A', 'C'};
+
+	for (auto i = 0U; i < 4; ++i)
+	{
+		initialState[i][0] = input[i].first;
+		initialState[i][1] = extra1[i];
+		initialState[i][2] = extra2[i];
+		initialState[i][3] = input[i].second;
+	}
+
+	return Burrow<4>(initialState);
+}
+
+std::uint64_t SolvePart1(const std::array<std::pair<char, char>, 4> &input)
+{
+	return Part1Burrow(input).Solve();
+}
+
+std::uint64_t SolvePart2(const std::array<std::pair<char, char>, 4> &input)
+{
+	return Part2Burrow(input).Solve();
+}
+
+}
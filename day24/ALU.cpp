@@ -5,6 +5,9 @@
 #include "ALU.hpp"
 #include <stdexcept>
 
+namespace day24
+{
+
 void ALU::ApplyInstruction(const Instruction &instruction)
 {
 	if (instruction.op == Op::Inp)
@@ -86,3 +89,5 @@ bool ALU::IsSolved() const
 {
 	return z == 0;
 }
+
+}
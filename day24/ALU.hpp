@@ -5,12 +5,15 @@
 #include <functional>
 #include "Instruction.hpp"
 
-
-
+namespace day24
+{
 class ALU;
-template <> struct std::hash<ALU>;
+}
 
+template <> struct std::hash<day24::ALU>;
 
+namespace day24
+{
 
 class ALU
 {
@@ -25,7 +28,7 @@ private:
 	std::int64_t &GetVariable(const Variable &var);
 	std::int64_t GetValue(const std::variant<std::monostate, Variable, std::int64_t> &operand);
 
-	friend struct std::hash<ALU>;
+	friend struct std::hash<day24::ALU>;
 
 private:
 	std::int64_t x = 0;
@@ -34,12 +37,13 @@ private:
 	std::int64_t w = 0;
 };
 
+}
 
 // custom specialization of std::hash can be injected in namespace std
 template<>
-struct std::hash<ALU>
+struct std::hash<day24::ALU>
 {
-	std::size_t operator()(const ALU &alu) const noexcept
+	std::size_t operator()(const day24::ALU &alu) const noexcept
 	{
 		const auto h1 = std::hash<std::int64_t>{}(alu.x);
 		const auto h2 = std::hash<std::int64_t>{}(alu.y);
@@ -6,27 +6,24 @@
 #include "shared.hpp"
 #include <stdexcept>
 
-Instruction ParseInstruction(const std::string &str)
+namespace day24
 {
-	const auto elems = SplitStringWhitespace(str);
-	const auto &instruction = elems[0];
+
+Instruction ParseInstruction(std::string_view str)
+{
+	const SplitView tokens{str};
+	const auto instruction = *tokens.begin();
 
 	if (instruction == "inp")
 	{
-		if (elems.size() != 2)
-		{
-			throw std::runtime_error("Failed to parse input");
-		}
+		const auto elems = SplitTokens<2>(tokens);
 
 		auto operand = StrToOperand(elems[1]);
 		return {Op::Inp, std::get<Variable>(operand), std::monostate()};
 	}
 	else
 	{
-		if (elems.size() != 3)
-		{
-			throw std::runtime_error("Failed to parse input");
-		}
+		const auto elems = SplitTokens<3>(tokens);
 		Instruction instr;
 		instr.firstOperand = std::get<Variable>(StrToOperand(elems[1]));
 		instr.secondOperand = StrToOperand(elems[2]);
@@ -59,7 +56,7 @@ Instruction ParseInstruction(const std::string &str)
 	}
 }
 
-std::variant<std::monostate, Variable, std::int64_t> StrToOperand(const std::string &str)
+std::variant<std::monostate, Variable, std::int64_t> StrToOperand(std::string_view str)
 {
 	switch (str.front())
 	{
@@ -74,4 +71,6 @@ std::variant<std::monostate, Variable, std::int64_t> StrToOperand(const std::str
 		default:
 			return StrToInteger<std::int64_t>(str);
 	}
-}
\ No newline at end of file
+}
+
+}
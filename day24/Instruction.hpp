@@ -5,6 +5,10 @@
 #include <variant>
 #include <cstdint>
 #include <string>
+#include <string_view>
+
+namespace day24
+{
 
 enum class Op
 {
@@ -32,7 +36,9 @@ struct Instruction
 	std::variant<std::monostate, Variable, std::int64_t> secondOperand;
 };
 
-Instruction ParseInstruction(const std::string &str);
-std::variant<std::monostate, Variable, std::int64_t> StrToOperand(const std::string &str);
+Instruction ParseInstruction(std::string_view str);
+std::variant<std::monostate, Variable, std::int64_t> StrToOperand(std::string_view str);
+
+}
 
 #endif //ADVENTOFCODE2021_INSTRUCTION_HPP
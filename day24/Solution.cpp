@@ -0,0 +1,133 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "Instrumentation.hpp"
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "Instruction.hpp"
+#include "ALU.hpp"
+#include "Parallel.hpp"
+
+namespace day24
+{
+
+std::vector<Instruction> ParseInput(const std::vector<std::string_view> &lines);
+
+std::pair<std::int64_t, std::int64_t> Solve(const std::vector<Instruction> &instructions);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	struct State
+	{
+		std::vector<Instruction> input;
+		std::pair<std::int64_t, std::int64_t> results;
+	};
+	auto state = std::make_shared<State>();
+
+	harness.AddPhase("Parse", [state](const InputFile &file)
+	{
+		state->input = ParseInput(file.Lines());
+	});
+	harness.AddPhase("Solve", [state](const InputFile &)
+	{
+		state->results = Solve(state->input);
+	});
+	harness.AddResult("Part 1", [state]
+	{
+		return ResultToString(state->results.first);
+	});
+	harness.AddResult("Part 2", [state]
+	{
+		return ResultToString(state->results.second);
+	});
+}
+
+
+
+
+std::vector<Instruction> ParseInput(const std::vector<std::string_view> &lines)
+{
+	std::vector<Instruction> result{};
+	result.reserve(lines.size());
+
+	for (const auto &line: lines)
+	{
+		result.push_back(ParseInstruction(line));
+	}
+
+	return result;
+}
+
+std::pair<std::int64_t, std::int64_t> Solve(const std::vector<Instruction> &instructions)
+{
+	AOC_SCOPED_TIMER("day24.Solve");
+
+	using AluState = std::pair<ALU, std::pair<std::int64_t, std::int64_t>>;
+
+	(void) instructions;
+	std::vector<AluState> ALUs { {{}, {0, 0}}};
+
+	for (const auto &instruction: instructions)
+	{
+		if (instruction.op == Op::Inp)
+		{
+			std::vector<AluState> newALUs {};
+			std::unordered_map<ALU, std::size_t> cache;
+			for (const auto &alu: ALUs)
+			{
+				for (auto digit = 1; digit <= 9; ++digit)
+				{
+					auto newAlu = alu;
+					newAlu.first.ApplyInputInstruction(instruction, digit);
+					newAlu.second.first = (newAlu.second.first * 10) + digit;
+					newAlu.second.second = (newAlu.second.second * 10) + digit;
+					if (cache.contains(newAlu.first))
+					{
+						AOC_COUNTER_INCREMENT("day24.states_merged");
+						const auto index = cache.at(newAlu.first);
+						newALUs[index].second.first = std::min(newALUs[index].second.first, newAlu.second.first);
+						newALUs[index].second.second = std::max(newALUs[index].second.second, newAlu.second.second);
+					}
+					else
+					{
+						cache.emplace(newAlu.first, newALUs.size());
+						newALUs.push_back(newAlu);
+					}
+				}
+
+			}
+			ALUs = std::move(newALUs);
+			AOC_HISTOGRAM_RECORD("day24.states_per_input", ALUs.size());
+		}
+		else
+		{
+			ParallelFor(0, ALUs.size(), 4096, [&ALUs, &i = std::as_const(instruction)](std::size_t index)
+			{
+				ALUs[index].first.ApplyInstruction(i);
+			});
+		}
+	}
+
+	std::int64_t low = std::numeric_limits<std::int64_t>::max();
+	std::int64_t high = std::numeric_limits<std::int64_t>::min();
+
+	for (const auto &[alu, val]: ALUs)
+	{
+		if (alu.IsSolved())
+		{
+			low = std::min(low, val.first);
+			high = std::max(high, val.second);
+		}
+	}
+
+	return {high, low};
+}
+
+}
@@ -6,6 +6,9 @@
 #include <stdexcept>
 #include <sstream>
 
+namespace day25
+{
+
 Cucumber CucumberField::CharacterToCucumber(char c)
 {
 	switch (c)
@@ -21,118 +24,71 @@ Cucumber CucumberField::CharacterToCucumber(char c)
 	}
 }
 
-CucumberField::CucumberField(const std::vector<std::vector<char>> &input)
+namespace
 {
-	height = input.size();
-	width = input.front().size();
-	field.reserve(width * height);
 
-	for (const auto &row: input)
+Grid2D<Cucumber> MakeField(const std::vector<std::vector<char>> &input, Cucumber (*convert)(char))
+{
+	Grid2D<Cucumber> result{input.front().size(), input.size(), 1};
+	for (auto y = 0U; y < result.Height(); ++y)
 	{
-		for (const auto &c: row)
+		for (auto x = 0U; x < result.Width(); ++x)
 		{
-			field.push_back(CharacterToCucumber(c));
+			result(x, y) = convert(input[y][x]);
 		}
 	}
+	return result;
 }
 
+}
 
-bool CucumberField::Step()
+CucumberField::CucumberField(const std::vector<std::vector<char>> &input)
+		: field(MakeField(input, CharacterToCucumber))
 {
-	std::vector<Cucumber>  horizontalField(width * height, Cucumber::None);
-	auto frozen = true;
-
-	for (auto y = 0U; y < height; ++y)
-	{
-		for (auto x = 0U; x < width; ++x)
-		{
-			const auto index = y * width + x;
-			switch (field[index])
-			{
-				case Cucumber::None:
-					continue;
-				case Cucumber::East:
-				{
-					const auto targetX = (x + 1) % width;
-					const auto targetIndex = y * width + targetX;
+}
 
-					switch (field[targetIndex])
-					{
-						case Cucumber::None:
-						{
-							frozen = false;
-							horizontalField[index] = Cucumber::None;
-							horizontalField[targetIndex] = Cucumber::East;
-							break;
-						}
-						case Cucumber::East: [[fallthrough]];
-						case Cucumber::South:
-						{
-							horizontalField[index] = Cucumber::East;
-							break;
-						}
-					}
-					break;
-				}
-				case Cucumber::South:
-					horizontalField[index] = Cucumber::South;
-					break;
-			}
-		}
-	}
+template<Cucumber Herd>
+bool CucumberField::MoveHerd()
+{
+	auto &current = field.Current();
+	auto &next = field.Next();
+	current.WrapBorder();
 
-	std::vector<Cucumber>  verticalField(horizontalField);
-	for (auto y = 0U; y < height; ++y)
+	const auto ahead = current.Offset(Herd == Cucumber::East ? GridOffset{1, 0} : GridOffset{0, 1});
+	auto moved = false;
+	for (auto y = 0U; y < current.Height(); ++y)
 	{
-		for (auto x = 0U; x < width; ++x)
+		auto index = current.Index(0, y);
+		for (auto x = 0U; x < current.Width(); ++x, ++index)
 		{
-			const auto index = y * width + x;
-			switch (horizontalField[index])
-			{
-				case Cucumber::None:
-					continue;
-				case Cucumber::South:
-				{
-					const auto targetY = (y + 1) % height;
-					const auto targetIndex = targetY * width + x;
-
-					switch (horizontalField[targetIndex])
-					{
-						case Cucumber::None:
-						{
-							frozen = false;
-							verticalField[index] = Cucumber::None;
-							verticalField[targetIndex] = Cucumber::South;
-							break;
-						}
-						case Cucumber::East: [[fallthrough]];
-						case Cucumber::South:
-						{
-							verticalField[index] = Cucumber::South;
-							break;
-						}
-					}
-					break;
-				}
-				case Cucumber::East:
-					verticalField[index] = Cucumber::East;
-					break;
-			}
+			// Every cell is decided by itself and its neighbours along the direction of the herd.
+			const auto cell = current[index];
+			const auto leaves = cell == Herd && current[index + ahead] == Cucumber::None;
+			const auto arrives = cell == Cucumber::None && current[index - ahead] == Herd;
+			next[index] = leaves ? Cucumber::None : arrives ? Herd : cell;
+			moved |= leaves;
 		}
 	}
-	field = std::move(verticalField);
-	return !frozen;
+	field.Flip();
+	return moved;
+}
+
+bool CucumberField::Step()
+{
+	const auto movedEast = MoveHerd<Cucumber::East>();
+	const auto movedSouth = MoveHerd<Cucumber::South>();
+	return movedEast || movedSouth;
 }
 
 std::string CucumberField::ToString() const
 {
 	std::ostringstream oss;
-	for (auto y = 0U; y < height; ++y)
+	const auto &current = field.Current();
+	for (auto y = 0U; y < current.Height(); ++y)
 	{
-		for (auto x = 0U; x < width; ++x)
+		for (auto x = 0U; x < current.Width(); ++x)
 		{
-			const auto index = y * width + x;
-			switch (field[index])
+			switch (current(x, y))
 			{
 				case Cucumber::None:
 					oss << '.';
@@ -151,3 +107,4 @@ std::string CucumberField::ToString() const
 	return oss.str();
 }
 
+}
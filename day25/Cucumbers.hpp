@@ -6,10 +6,15 @@
 #define ADVENTOFCODE2021_CUCUMBERS_HPP
 
 
+#include "Grid2D.hpp"
+#include <cstdint>
 #include <vector>
 #include <string>
 
-enum class Cucumber
+namespace day25
+{
+
+enum class Cucumber : std::uint8_t
 {
 	None,
 	East,
@@ -28,12 +33,15 @@ public:
 
 private:
 	static Cucumber CharacterToCucumber(char c);
+	// Moves every cucumber of one herd that faces an empty cell, returns whether any moved.
+	template<Cucumber Herd>
+	bool MoveHerd();
 
 private:
-	std::size_t width;
-	std::size_t height;
-	std::vector<Cucumber> field;
+	// One cell of wrapped border so the moves need no modulo.
+	DoubleBuffered<Grid2D<Cucumber>> field;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_CUCUMBERS_HPP
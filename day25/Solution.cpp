@@ -0,0 +1,90 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <vector>
+#include "Cucumbers.hpp"
+
+namespace day25
+{
+
+std::vector<std::vector<char>> ParseInput(const std::vector<std::string_view> &lines);
+std::uint64_t Solve(const std::vector<std::vector<char>> &input);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	struct State
+	{
+		std::vector<std::vector<char>> input;
+		std::uint64_t result{};
+	};
+	auto state = std::make_shared<State>();
+
+	harness.AddPhase("Parse", [state](const InputFile &file)
+	{
+		state->input = ParseInput(file.Lines());
+	});
+	harness.AddPhase("Solve", [state](const InputFile &)
+	{
+		state->result = Solve(state->input);
+	});
+	harness.AddResult("Part 1", [state]
+	{
+		return ResultToString(state->result);
+	});
+}
+
+std::vector<std::vector<char>> ParseInput(const std::vector<std::string_view> &lines)
+{
+	std::vector<std::vector<char>> result;
+	result.reserve(lines.size());
+
+	const auto width = lines.front().size();
+	for (const auto &line: lines)
+	{
+		if (line.size() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		std::vector<char> row;
+		row.reserve(line.size());
+		for (const auto &c: line)
+		{
+			if (c == '>' || c == 'v' || c == '.')
+			{
+				row.push_back(c);
+			}
+			else
+			{
+				throw std::runtime_error("Failed to parse input");
+			}
+		}
+		result.push_back(std::move(row));
+	}
+	return result;
+}
+std::uint64_t Solve(const std::vector<std::vector<char>> &input)
+{
+	CucumberField field(input);
+#ifndef NDEBUG
+	std::cout << field.ToString() << "__________\r\n";
+#endif
+
+	std::uint64_t counter {};
+	do
+	{
+		++counter;
+	}
+	while(field.Step());
+
+#ifndef NDEBUG
+	std::cout << field.ToString() << "__________\r\n";
+#endif
+	return counter;
+}
+
+}
@@ -0,0 +1,247 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <functional>
+#include <bitset>
+#include <array>
+#include <numeric>
+
+namespace day3
+{
+
+template<size_t N>
+std::vector<std::bitset<N>> LinesToBitsets(const std::vector<std::string_view> &lines);
+
+template<size_t N>
+std::uint32_t SolvePart1(const std::vector<std::bitset<N>> &input);
+
+template<size_t N>
+std::uint32_t SolvePart2(const std::vector<std::bitset<N>> &input);
+
+template<size_t N>
+std::uint32_t FindRating(const std::vector<std::bitset<N>> &input,
+                         const std::function<std::uint8_t(
+		                         const std::vector<std::bitset<N>> &input, std::uint8_t position
+                         )> &criterion);
+
+template<size_t N>
+std::uint8_t FindMostCommonBit(const std::vector<std::bitset<N>> &input, std::uint8_t position);
+
+template<size_t N>
+std::uint8_t FindLeastCommonBit(const std::vector<std::bitset<N>> &input, std::uint8_t position);
+
+constexpr auto BitWidth = 12;
+
+// Fold for --stream runs. Both ratings only depend on how often every N bit value occurs, so a
+// histogram of 2^N counters replaces the list of numbers.
+template<size_t N>
+class DiagnosticFold
+{
+public:
+	DiagnosticFold() : _histogram(std::size_t{1} << N)
+	{}
+
+	void Consume(std::string_view line)
+	{
+		if (line.length() != N)
+		{
+			throw std::runtime_error("Invalid input");
+		}
+		++_histogram[StrToInteger<std::uint32_t>(line, 2)];
+	}
+
+	[[nodiscard]] std::uint32_t Part1() const
+	{
+		std::uint32_t gamma{};
+		for (auto i = 0U; i < N; ++i)
+		{
+			const auto [zeros, ones] = CountBit(0, _histogram.size(), i);
+			if (ones > zeros)
+			{
+				gamma |= 1U << i;
+			}
+		}
+		const auto epsilon = ~gamma & ((1U << N) - 1);
+		return gamma * epsilon;
+	}
+
+	[[nodiscard]] std::uint32_t Part2() const
+	{
+		return FindRating(true) * FindRating(false);
+	}
+
+private:
+	// Occurrences of values in [begin, end) with bit i clear and set.
+	[[nodiscard]] std::pair<std::uint64_t, std::uint64_t> CountBit(std::size_t begin, std::size_t end, std::size_t i) const
+	{
+		std::pair<std::uint64_t, std::uint64_t> result{};
+		for (auto value = begin; value < end; ++value)
+		{
+			(((value >> i) & 1U) != 0 ? result.second : result.first) += _histogram[value];
+		}
+		return result;
+	}
+
+	// Values sharing the bits decided so far form the range [begin, end), every step keeps one half.
+	[[nodiscard]] std::uint32_t FindRating(bool mostCommon) const
+	{
+		std::size_t begin = 0;
+		std::size_t end = _histogram.size();
+		for (auto position = N; position-- > 0;)
+		{
+			const auto middle = begin + (end - begin) / 2;
+			const auto split = _histogram.begin() + static_cast<std::ptrdiff_t>(middle);
+			const auto zeros = std::accumulate(_histogram.begin() + static_cast<std::ptrdiff_t>(begin), split,
+			                                   std::uint64_t{0});
+			const auto ones = std::accumulate(split, _histogram.begin() + static_cast<std::ptrdiff_t>(end),
+			                                  std::uint64_t{0});
+			if (zeros + ones <= 1)
+			{
+				break;
+			}
+			const auto keepOnes = (ones >= zeros) == mostCommon;
+			if ((keepOnes && ones > 0) || zeros == 0)
+			{
+				begin = middle;
+			}
+			else
+			{
+				end = middle;
+			}
+		}
+
+		for (auto value = begin; value < end; ++value)
+		{
+			if (_histogram[value] > 0)
+			{
+				return static_cast<std::uint32_t>(value);
+			}
+		}
+		throw std::runtime_error("Invalid input");
+	}
+
+private:
+	std::vector<std::uint64_t> _histogram;
+};
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return LinesToBitsets<BitWidth>(file.Lines());
+	                 },
+	                 SolvePart1<BitWidth>,
+	                 SolvePart2<BitWidth>);
+	RegisterStreamingFold<DiagnosticFold<BitWidth>>(harness);
+}
+
+template<size_t N>
+std::vector<std::bitset<N>> LinesToBitsets(const std::vector<std::string_view> &lines)
+{
+	std::vector<std::bitset<N>> result;
+	result.reserve(lines.size());
+	for (const auto &line: lines)
+	{
+		if (line.length() != N)
+		{
+			throw std::runtime_error("Invalid input");
+		}
+		const auto integer = StrToInteger<std::uint32_t>(line, 2);
+		result.emplace_back(integer);
+	}
+	return result;
+}
+
+template<size_t N>
+std::uint32_t SolvePart1(const std::vector<std::bitset<N>> &input)
+{
+	std::array<std::int16_t, N> counters{};
+	for (const auto &bits: input)
+	{
+		for (auto i = 0U; i < N; ++i)
+		{
+			if (bits.test(i))
+			{
+				++counters[i];
+			}
+			else
+			{
+				--counters[i];
+			}
+		}
+	}
+	std::bitset<N> gamma{};
+	for (auto i = 0U; i < N; ++i)
+	{
+		if (counters.at(i) > 0)
+		{
+			gamma.set(i);
+		}
+	}
+	auto epsilon = gamma;
+	epsilon.flip();
+
+	return gamma.to_ulong() * epsilon.to_ulong();
+}
+
+template<size_t N>
+std::uint32_t SolvePart2(const std::vector<std::bitset<N>> &input)
+{
+	const auto generator = FindRating(input, FindMostCommonBit<N>);
+	const auto scrubber = FindRating(input, FindLeastCommonBit<N>);
+	return generator * scrubber;
+}
+
+template<size_t N>
+std::uint32_t FindRating(const std::vector<std::bitset<N>> &input,
+                         const std::function<std::uint8_t(
+		                         const std::vector<std::bitset<N>> &input, std::uint8_t position
+                         )> &criterion)
+{
+	std::vector<std::bitset<N>> data = input;
+	std::uint8_t position = N - 1;
+	while (data.size() > 1)
+	{
+		const auto keepBit = criterion(data, position);
+		auto it = std::remove_if(data.begin(), data.end(),
+		                         [keepBit, position](const std::bitset<N> &bits)
+		                         {
+			                         return bits[position] != static_cast<bool>(keepBit);
+		                         });
+		data.erase(it, data.end());
+		position--;
+	}
+	return data.front().to_ulong();
+}
+
+template<size_t N>
+std::uint8_t FindMostCommonBit(const std::vector<std::bitset<N>> &input, std::uint8_t position)
+{
+	std::int16_t counter{};
+	for (const auto &bits: input)
+	{
+		if (bits.test(position))
+		{
+			++counter;
+		}
+		else
+		{
+			--counter;
+		}
+	}
+
+	return counter >= 0;
+}
+
+template<size_t N>
+std::uint8_t FindLeastCommonBit(const std::vector<std::bitset<N>> &input, std::uint8_t position)
+{
+	return !FindMostCommonBit(input, position);
+}
+
+}
@@ -6,6 +6,9 @@
 #include <array>
 #include <optional>
 
+namespace day4
+{
+
 class Board
 {
 public:
@@ -21,5 +24,6 @@ private:
 	std::array<std::pair<std::uint8_t, bool>, 25> _elements;
 };
 
+}
 
 #endif //ADVENTOFCODE2021_BINGOBAORD_HPP
@@ -1,6 +1,10 @@
 #include "BingoBaord.hpp"
 #include <stdexcept>
 #include <numeric>
+#include <algorithm>
+
+namespace day4
+{
 
 Board::Board(std::uint8_t boardNumber, const std::vector<std::uint8_t> &elements) :
 		_boardNumber(boardNumber), _elements()
@@ -83,3 +87,5 @@ std::uint8_t Board::GetBoardNumber() const
 {
 	return _boardNumber;
 }
+
+}
@@ -0,0 +1,137 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "BingoBaord.hpp"
+#include <iostream>
+#include <algorithm>
+
+namespace day4
+{
+
+std::pair<std::vector<std::uint8_t>, std::vector<Board>> ParseInput(const std::vector<std::string_view> &input);
+
+std::vector<std::uint8_t> ParseNumbers(std::string_view numbers);
+
+std::uint32_t SolvePart1(const std::vector<std::uint8_t> &numbers, std::vector<Board> boards);
+
+std::uint32_t SolvePart2(const std::vector<std::uint8_t> &numbers, std::vector<Board> boards);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart1(input.first, input.second);
+	                 },
+	                 [](const auto &input)
+	                 {
+		                 return SolvePart2(input.first, input.second);
+	                 });
+}
+
+std::pair<std::vector<std::uint8_t>, std::vector<Board>> ParseInput(const std::vector<std::string_view> &input)
+{
+	if (input.empty())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	auto cursor = input.begin();
+	auto numbers = ParseNumbers(*cursor);
+	++cursor;
+
+	std::uint8_t boardNumber = 1;
+	std::vector<Board> boards;
+	std::vector<std::uint8_t> boardElements;
+	boardElements.reserve(25);
+	while (cursor != input.end())
+	{
+		const auto remaining = std::distance(cursor, input.end());
+		if (remaining < 6)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		if (!cursor->empty())
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		std::advance(cursor, 1);
+		boardElements.clear();
+		for (auto it = cursor; it != cursor + 5; ++it)
+		{
+			AppendIntegers(SplitView{*it}, boardElements);
+		}
+
+		boards.emplace_back(boardNumber++, boardElements);
+		std::advance(cursor, 5);
+	}
+
+
+	return std::make_pair(std::move(numbers), std::move(boards));
+}
+
+std::vector<std::uint8_t> ParseNumbers(std::string_view numbers)
+{
+	return ParseIntegerList<std::uint8_t>(numbers);
+}
+
+std::uint32_t SolvePart1(const std::vector<std::uint8_t> &numbers, std::vector<Board> boards)
+{
+	for (const auto &number: numbers)
+	{
+		for (auto &board: boards)
+		{
+			auto result = board.MarkNumber(number);
+			if (result.has_value())
+			{
+				return result.value();
+			}
+		}
+	}
+
+	throw std::runtime_error("Failed to solve part 1");
+}
+
+std::uint32_t SolvePart2(const std::vector<std::uint8_t> &numbers, std::vector<Board> boards)
+{
+	for (const auto &number: numbers)
+	{
+		if (boards.empty()) break;
+		std::vector<std::uint8_t> boardsToRemove;
+		for (auto it = boards.begin(); it != boards.end(); ++it)
+		{
+			auto result = it->MarkNumber(number);
+			if (result.has_value())
+			{
+				if (boards.size() == 1)
+				{
+					return result.value();
+				}
+				else
+				{
+					boardsToRemove.push_back(it->GetBoardNumber());
+				}
+			}
+		}
+		auto it = std::remove_if(boards.begin(), boards.end(),
+		                         [&boardsToRemove](const Board &board)
+		                         {
+			                         return std::find(boardsToRemove.begin(), boardsToRemove.end(),
+			                                          board.GetBoardNumber()) != boardsToRemove.end();
+		                         }
+		);
+		boards.erase(it, boards.end());
+	}
+
+	throw std::runtime_error("Failed to solve part 2");
+}
+
+}
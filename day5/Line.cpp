@@ -1,5 +1,8 @@
 #include "Line.hpp"
 
+namespace day5
+{
+
 Line::Line(const Point &p1, const Point &p2)
 	: _points({p1, p2})
 {
@@ -19,3 +22,5 @@ const std::array<std::pair<std::uint16_t, std::uint16_t>, 2> &Line::GetPoints()
 {
 	return _points;
 }
+
+}
@@ -5,6 +5,9 @@
 #include <cstdint>
 #include <array>
 
+namespace day5
+{
+
 class Line
 {
 public:
@@ -20,4 +23,6 @@ public:
 	const std::array<std::pair<std::uint16_t, std::uint16_t>, 2> &GetPoints() const;
 };
 
+}
+
 #endif //ADVENTOFCODE2021_LINE_HPP
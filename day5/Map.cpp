@@ -2,6 +2,9 @@
 #include <stdexcept>
 #include <sstream>
 
+namespace day5
+{
+
 Map::Map(std::size_t size)
 	: _size(size + 1)
 {
@@ -121,4 +124,4 @@ void Map::DrawDiagonalLine(const Line &line)
 	}
 }
 
-
+}
@@ -6,6 +6,9 @@
 #include <string>
 #include "Line.hpp"
 
+namespace day5
+{
+
 class Map
 {
 public:
@@ -24,4 +27,7 @@ private:
 	const std::size_t _size;
 	std::vector<std::uint8_t> _map;
 };
+
+}
+
 #endif //ADVENTOFCODE2021_MAP_HPP
@@ -0,0 +1,153 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "Line.hpp"
+#include "Map.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <vector>
+#include <iterator>
+
+namespace day5
+{
+
+std::vector<Line> ParseInput(const std::vector<std::string_view> &input);
+std::vector<Line> UnpackInput(const PackedReader &reader);
+Line ParseLine(std::string_view line);
+std::size_t FindMapSize(const std::vector<Line> &input);
+
+std::size_t SolvePart1(const std::vector<Line> &input);
+std::size_t SolvePart2(const std::vector<Line> &input);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return UnpackInput(PackedReader{file.Contents(), 5});
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+// Four U16 columns: x1, y1, x2, y2.
+std::string Pack(const InputFile &input)
+{
+	std::array<std::vector<std::uint16_t>, 4> columns;
+	for (const auto &line: ParseInput(input.Lines()))
+	{
+		const auto &[first, second] = line.GetPoints();
+		columns[0].push_back(first.first);
+		columns[1].push_back(first.second);
+		columns[2].push_back(second.first);
+		columns[3].push_back(second.second);
+	}
+
+	PackedWriter writer{5};
+	for (const auto &column: columns)
+	{
+		writer.AddArray<std::uint16_t>(column);
+	}
+	return writer.Finish();
+}
+
+std::vector<Line> UnpackInput(const PackedReader &reader)
+{
+	const auto x1 = reader.Array<std::uint16_t>(0);
+	const auto y1 = reader.Array<std::uint16_t>(1);
+	const auto x2 = reader.Array<std::uint16_t>(2);
+	const auto y2 = reader.Array<std::uint16_t>(3);
+	if (y1.size() != x1.size() || x2.size() != x1.size() || y2.size() != x1.size())
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	std::vector<Line> result;
+	result.reserve(x1.size());
+	for (auto i = 0U; i < x1.size(); ++i)
+	{
+		result.emplace_back(Line::Point{x1[i], y1[i]}, Line::Point{x2[i], y2[i]});
+	}
+	return result;
+}
+
+std::vector<Line> ParseInput(const std::vector<std::string_view> &input)
+{
+	// Vent lines are independent of each other, chunks of them are parsed concurrently.
+	return ParallelMap(0, input.size(), 1024, [&input](std::size_t i)
+	{
+		return ParseLine(input[i]);
+	});
+}
+
+Line ParseLine(std::string_view line)
+{
+	const auto parsePoint = [](std::string_view pointStr)
+	{
+		const auto [x, y] = ParseIntegers<std::uint16_t, 2>(SplitView{pointStr, ','});
+		return std::make_pair(x, y);
+	};
+
+	const auto lineSplit = SplitTokens<3>(SplitView{line});
+	return {parsePoint(lineSplit[0]), parsePoint(lineSplit[2])};
+}
+
+
+std::size_t SolvePart1(const std::vector<Line> &input)
+{
+	const auto mapSize = FindMapSize(input);
+	auto map = Map{mapSize};
+	for (const auto &line: input)
+	{
+		if (line.IsHorizontal() || line.IsVertical())
+		{
+			map.DrawLine(line);
+		}
+	}
+//	std::cout << map.DrawMap();
+	return map.CountIntersections();
+}
+
+std::size_t SolvePart2(const std::vector<Line> &input)
+{
+	const auto mapSize = FindMapSize(input);
+	auto map = Map{mapSize};
+	for (const auto &line: input)
+	{
+		map.DrawLine(line);
+	}
+//	std::cout << map.DrawMap();
+	return map.CountIntersections();
+}
+
+std::size_t FindMapSize(const std::vector<Line> &input)
+{
+	std::size_t size {};
+	for (const auto &line: input)
+	{
+		const auto points = line.GetPoints();
+		for(const auto &point: points)
+		{
+			if (point.first > size)
+			{
+				size = point.first;
+			}
+
+			if (point.second > size)
+			{
+				size = point.second;
+			}
+		}
+	}
+	return size;
+}
+
+}
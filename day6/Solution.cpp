@@ -0,0 +1,96 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <array>
+#include <numeric>
+#include <vector>
+
+namespace day6
+{
+
+std::vector<std::uint8_t> ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t RunSimulation(const std::vector<std::uint8_t> &seed, std::uint16_t days);
+
+std::uint64_t SolvePart1(const std::vector<std::uint8_t> &seed);
+
+std::uint64_t SolvePart2(const std::vector<std::uint8_t> &seed);
+
+using State = std::array<std::uint64_t, 9>;
+
+State SimulateDay(const State &currentState);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::vector<std::uint8_t> ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.size() != 1)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	return ParseIntegerList<std::uint8_t>(lines.front());
+}
+
+
+std::uint64_t SolvePart1(const std::vector<std::uint8_t> &seed)
+{
+	return RunSimulation(seed, 80);
+}
+
+std::uint64_t SolvePart2(const std::vector<std::uint8_t> &seed)
+{
+	return RunSimulation(seed, 256);
+}
+
+State SimulateDay(const State &currentState)
+{
+	State newState{};
+	for (auto i = 0U; i < newState.size(); ++i)
+	{
+		if (i == 8)
+		{
+			newState[i] = currentState[0];
+		}
+		else if (i == 6)
+		{
+			newState[i] = currentState[0] + currentState[i + 1];
+		}
+		else
+		{
+			newState[i] = currentState[i + 1];
+		}
+	}
+	return newState;
+}
+
+std::uint64_t RunSimulation(const std::vector<std::uint8_t> &seed, std::uint16_t days)
+{
+	State state{};
+	for (const auto &fish: seed)
+	{
+		state[fish] += 1;
+	}
+
+	for (auto i = 0U; i < days; ++i)
+	{
+		state = SimulateDay(state);
+	}
+
+	return std::accumulate(state.begin(), state.end(), 0UL);
+}
+
+}
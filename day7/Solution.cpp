@@ -0,0 +1,88 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace day7
+{
+
+std::vector<std::uint16_t> ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(std::vector<std::uint16_t> startingPositions);
+std::uint64_t SolvePart2(std::vector<std::uint16_t> startingPositions);
+
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::vector<std::uint16_t> ParseInput(const std::vector<std::string_view> &lines)
+{
+	if (lines.size() != 1)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	return ParseIntegerList<std::uint16_t>(lines.front());
+}
+
+
+std::uint64_t SolvePart1(std::vector<std::uint16_t> startingPositions)
+{
+	std::sort(startingPositions.begin(), startingPositions.end());
+
+	const auto findMedian = [](const std::vector<std::uint16_t> &vec)
+	{
+		if (vec.size() % 2 == 0)
+		{
+			return static_cast<std::uint16_t>((vec[vec.size() / 2 - 1] + vec[vec.size() / 2]) / 2);
+		}
+		else
+		{
+			return vec[vec.size() / 2];
+		}
+	};
+
+	std::uint16_t median = findMedian(startingPositions);
+
+	return std::transform_reduce(startingPositions.begin(), startingPositions.end(), 0,
+	                             std::plus<>(),
+	                             [median](const auto &elem)
+	                             {
+		                             return std::abs(elem - median);
+	                             });
+}
+
+std::uint64_t SolvePart2(std::vector<std::uint16_t> startingPositions)
+{
+	// The result should be in the interval [mean - 0.5, mean + 0.5]. This comes from the minimum of the fuel usage function
+
+	const auto findFuelUsage = [](const std::vector<std::uint16_t> &startingPositions, uint16_t desiredPosition)
+	{
+		std::uint64_t usage = {};
+		for (const auto &position: startingPositions)
+		{
+			const auto diff = std::abs(desiredPosition - position);
+			usage += (diff * diff + diff) / 2;
+		}
+		return usage;
+	};
+
+	const auto mean = std::accumulate(startingPositions.begin(), startingPositions.end(), 0UL) / startingPositions.size();
+
+	return std::min({findFuelUsage(startingPositions, mean), findFuelUsage(startingPositions, mean + 1), findFuelUsage(startingPositions, mean - 1)});
+}
+
+}
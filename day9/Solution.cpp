@@ -0,0 +1,158 @@
+
+#include "shared.hpp"
+#include "Harness.hpp"
+#include "Days.hpp"
+#include "SolverVersion.hpp"
+#include "PackedInput.hpp"
+#include "Grid2D.hpp"
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace day9
+{
+
+// Heights with a border of 9s: a border cell is never lower than a neighbour and never part of a basin.
+using Heightmap = Grid2D<std::uint8_t>;
+
+Heightmap ParseInput(const std::vector<std::string_view> &lines);
+
+std::uint64_t SolvePart1(const Heightmap &heightmap);
+
+std::uint64_t SolvePart2(const Heightmap &heightmap);
+
+bool IsLowPoint(const Heightmap &heightmap, const std::array<std::ptrdiff_t, 4> &offsets, std::size_t index);
+
+void Register(Harness &harness)
+{
+	harness.SetSolverVersion(AOC_SOLVER_VERSION);
+	RegisterSolution(harness,
+	                 [](const InputFile &file)
+	                 {
+		                 if (IsPackedInput(file.Contents()))
+		                 {
+			                 return ReadDigitGrid<std::uint8_t>(PackedReader{file.Contents(), 9}, 0, 1, std::uint8_t{9});
+		                 }
+		                 return ParseInput(file.Lines());
+	                 },
+	                 SolvePart1,
+	                 SolvePart2);
+}
+
+std::string Pack(const InputFile &input)
+{
+	PackedWriter writer{9};
+	AddDigitGrid(writer, input.Lines());
+	return writer.Finish();
+}
+
+Heightmap ParseInput(const std::vector<std::string_view> &lines)
+{
+	const std::size_t width = lines.front().length();
+	const std::size_t height = lines.size();
+
+	Heightmap heightmap{width, height, 1, 0, 9};
+	for (auto y = 0U; y < height; ++y)
+	{
+		const auto &line = lines[y];
+		if (line.length() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+
+		auto index = heightmap.Index(0, y);
+		for (const auto &c: line)
+		{
+			heightmap[index++] = c - '0';
+		}
+	}
+
+	return heightmap;
+}
+
+bool IsLowPoint(const Heightmap &heightmap, const std::array<std::ptrdiff_t, 4> &offsets, std::size_t index)
+{
+	auto lowPoint = true;
+	for (const auto offset: offsets)
+	{
+		lowPoint &= (heightmap[index] < heightmap[index + offset]);
+	}
+	return lowPoint;
+}
+
+std::uint64_t SolvePart1(const Heightmap &heightmap)
+{
+	const auto offsets = heightmap.Offsets(Neighbours4);
+
+	std::uint64_t result{};
+	for (auto y = 0U; y < heightmap.Height(); ++y)
+	{
+		auto index = heightmap.Index(0, y);
+		for (auto x = 0U; x < heightmap.Width(); ++x, ++index)
+		{
+			if (IsLowPoint(heightmap, offsets, index))
+			{
+				result += (heightmap[index] + 1);
+			}
+		}
+	}
+
+	return result;
+}
+
+std::uint64_t SolvePart2(const Heightmap &heightmap)
+{
+	const auto offsets = heightmap.Offsets(Neighbours4);
+
+	// Each low point floods its own basin, a basin with several low points is counted once per low point.
+	// Visited cells are stamped with the basin number so the visited grid is allocated once.
+	Grid2D<std::uint32_t> visited{heightmap.Width(), heightmap.Height(), 1};
+	std::uint32_t stamp{};
+	std::vector<std::size_t> stack;
+
+	std::vector<std::uint64_t> basins;
+	for (auto y = 0U; y < heightmap.Height(); ++y)
+	{
+		auto index = heightmap.Index(0, y);
+		for (auto x = 0U; x < heightmap.Width(); ++x, ++index)
+		{
+			if (!IsLowPoint(heightmap, offsets, index) || heightmap[index] == 9)
+			{
+				continue;
+			}
+
+			std::uint64_t size{};
+			visited[index] = ++stamp;
+			stack.push_back(index);
+			while (!stack.empty())
+			{
+				const auto current = stack.back();
+				stack.pop_back();
+				++size;
+
+				for (const auto offset: offsets)
+				{
+					const auto neighbour = current + offset;
+					if (heightmap[neighbour] != 9 && visited[neighbour] != stamp)
+					{
+						visited[neighbour] = stamp;
+						stack.push_back(neighbour);
+					}
+				}
+			}
+			basins.push_back(size);
+		}
+	}
+
+	if (basins.size() < 3)
+	{
+		throw std::runtime_error("Failed to solve part 2");
+	}
+
+	std::partial_sort(basins.begin(), basins.begin() + 3, basins.end(), std::greater<>());
+
+	return basins[0] * basins[1] * basins[2];
+}
+
+}
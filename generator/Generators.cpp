@@ -0,0 +1,693 @@
+#include "Generators.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	using Point = std::array<std::int64_t, 3>;
+
+	template<class T>
+	std::vector<T> Sequence(T count)
+	{
+		std::vector<T> result(static_cast<std::size_t>(count));
+		std::iota(result.begin(), result.end(), T{});
+		return result;
+	}
+
+	template<class T>
+	const T &Pick(const std::vector<T> &values, Random &random)
+	{
+		return values[static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(values.size()) - 1))];
+	}
+
+	void WriteDigitGrid(std::ostream &os, std::size_t width, std::size_t height, int low, int high, Random &random)
+	{
+		std::string line(width, '0');
+		for (auto y = 0U; y < height; ++y)
+		{
+			for (auto &c: line)
+			{
+				c = static_cast<char>('0' + random.Uniform(low, high));
+			}
+			os << line << '\n';
+		}
+	}
+
+	void GenerateDepths(std::ostream &os, std::size_t size, Random &random)
+	{
+		std::int64_t depth = random.Uniform(100, 200);
+		for (auto i = 0U; i < size; ++i)
+		{
+			depth = std::clamp<std::int64_t>(depth + random.Uniform(-20, 30), 0, 20000);
+			os << depth << '\n';
+		}
+	}
+
+	void GenerateCommands(std::ostream &os, std::size_t size, Random &random)
+	{
+		for (auto i = 0U; i < size; ++i)
+		{
+			const auto command = random.Uniform(0, 99);
+			os << (command < 40 ? "forward " : (command < 75 ? "down " : "up ")) << random.Uniform(1, 9) << '\n';
+		}
+	}
+
+	void GenerateDiagnostic(std::ostream &os, std::size_t size, Random &random)
+	{
+		// Distinct values, the rating filters of part 2 rely on ending up with exactly one line.
+		auto values = Sequence<std::uint16_t>(4096);
+		random.Shuffle(values);
+		for (auto i = 0U; i < size; ++i)
+		{
+			os << std::bitset<12>(values[i]) << '\n';
+		}
+	}
+
+	void GenerateBingo(std::ostream &os, std::size_t size, Random &random)
+	{
+		auto numbers = Sequence(100);
+		random.Shuffle(numbers);
+		for (auto i = 0U; i < numbers.size(); ++i)
+		{
+			os << (i == 0 ? "" : ",") << numbers[i];
+		}
+		os << '\n';
+
+		for (auto board = 0U; board < size; ++board)
+		{
+			random.Shuffle(numbers);
+			os << '\n';
+			for (auto row = 0U; row < 5; ++row)
+			{
+				for (auto column = 0U; column < 5; ++column)
+				{
+					const auto number = numbers[row * 5 + column];
+					os << (column == 0 ? "" : " ") << (number < 10 ? " " : "") << number;
+				}
+				os << '\n';
+			}
+		}
+	}
+
+	void GenerateVents(std::ostream &os, std::size_t size, Random &random)
+	{
+		constexpr std::int64_t Extent = 1000;
+		for (auto i = 0U; i < size; ++i)
+		{
+			const auto x1 = random.Uniform(0, Extent - 1);
+			const auto y1 = random.Uniform(0, Extent - 1);
+			const auto kind = random.Uniform(0, 9);
+			const std::int64_t dx = kind < 4 ? 0 : (random.Chance(0.5) ? 1 : -1);
+			const std::int64_t dy = kind >= 4 && kind < 8 ? 0 : (random.Chance(0.5) ? 1 : -1);
+
+			auto length = random.Uniform(0, 300);
+			while (x1 + dx * length < 0 || x1 + dx * length >= Extent || y1 + dy * length < 0 || y1 + dy * length >= Extent)
+			{
+				--length;
+			}
+			os << x1 << ',' << y1 << " -> " << x1 + dx * length << ',' << y1 + dy * length << '\n';
+		}
+	}
+
+	void GenerateCommaList(std::ostream &os, std::size_t size, std::int64_t low, std::int64_t high, Random &random)
+	{
+		for (auto i = 0U; i < size; ++i)
+		{
+			os << (i == 0 ? "" : ",") << random.Uniform(low, high);
+		}
+		os << '\n';
+	}
+
+	void GenerateLanternfish(std::ostream &os, std::size_t size, Random &random)
+	{
+		GenerateCommaList(os, size, 1, 5, random);
+	}
+
+	void GenerateCrabs(std::ostream &os, std::size_t size, Random &random)
+	{
+		GenerateCommaList(os, size, 0, 1999, random);
+	}
+
+	void GenerateSegments(std::ostream &os, std::size_t size, Random &random)
+	{
+		const std::array<std::string_view, 10> digits{
+				"abcefg", "cf", "acdeg", "acdfg", "bcdf", "abdfg", "abdefg", "acf", "abcdefg", "abcdfg"
+		};
+
+		std::vector<char> wiring{'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+		for (auto line = 0U; line < size; ++line)
+		{
+			random.Shuffle(wiring);
+			const auto scramble = [&wiring, &random](std::string_view digit)
+			{
+				std::vector<char> result;
+				for (const auto segment: digit)
+				{
+					result.push_back(wiring[static_cast<std::size_t>(segment - 'a')]);
+				}
+				random.Shuffle(result);
+				return std::string{result.begin(), result.end()};
+			};
+
+			auto order = Sequence<std::size_t>(10);
+			random.Shuffle(order);
+			for (const auto digit: order)
+			{
+				os << scramble(digits[digit]) << ' ';
+			}
+			os << '|';
+			for (auto i = 0U; i < 4; ++i)
+			{
+				os << ' ' << scramble(digits[static_cast<std::size_t>(random.Uniform(0, 9))]);
+			}
+			os << '\n';
+		}
+	}
+
+	void GenerateHeightmap(std::ostream &os, std::size_t size, Random &random)
+	{
+		std::string line(size, '0');
+		for (auto y = 0U; y < size; ++y)
+		{
+			for (auto &c: line)
+			{
+				// Walls of 9 split the map into basins.
+				c = random.Chance(0.45) ? '9' : static_cast<char>('0' + random.Uniform(0, 8));
+			}
+			os << line << '\n';
+		}
+	}
+
+	void GenerateBrackets(std::ostream &os, std::size_t size, Random &random)
+	{
+		constexpr std::string_view Open = "([{<";
+		constexpr std::string_view Close = ")]}>";
+		constexpr std::size_t MaxDepth = 20;
+
+		for (auto line = 0U; line < size; ++line)
+		{
+			std::string result;
+			std::vector<std::size_t> stack;
+			const auto length = random.Uniform(60, 110);
+			while (static_cast<std::int64_t>(result.size()) < length || stack.empty())
+			{
+				if (stack.empty() || (stack.size() < MaxDepth && random.Chance(0.55)))
+				{
+					stack.push_back(static_cast<std::size_t>(random.Uniform(0, 3)));
+					result.push_back(Open[stack.back()]);
+				}
+				else
+				{
+					result.push_back(Close[stack.back()]);
+					stack.pop_back();
+				}
+			}
+
+			// Every line is either corrupted by a wrong closing character or incomplete.
+			if (random.Chance(0.5))
+			{
+				const auto wrong = (stack.back() + static_cast<std::size_t>(random.Uniform(1, 3))) % 4;
+				result.push_back(Close[wrong]);
+				for (auto i = random.Uniform(0, 10); i > 0; --i)
+				{
+					result.push_back(Open[static_cast<std::size_t>(random.Uniform(0, 3))]);
+				}
+			}
+			os << result << '\n';
+		}
+	}
+
+	void GenerateOctopuses(std::ostream &os, std::size_t, Random &random)
+	{
+		WriteDigitGrid(os, 10, 10, 0, 9, random);
+	}
+
+	void GenerateCaves(std::ostream &os, std::size_t size, Random &random)
+	{
+		std::vector<std::string> caves;
+		std::vector<bool> big;
+		for (auto i = 0U; i < size; ++i)
+		{
+			caves.push_back({static_cast<char>('a' + i / 26), static_cast<char>('a' + i % 26)});
+			big.push_back(false);
+		}
+		for (auto i = 0U; i < std::max<std::size_t>(1, size / 4); ++i)
+		{
+			caves.push_back({static_cast<char>('A' + i / 26), static_cast<char>('A' + i % 26)});
+			big.push_back(true);
+		}
+
+		// Two big caves must never be connected, the number of paths would be infinite.
+		std::set<std::pair<std::size_t, std::size_t>> edges;
+		const auto connect = [&](std::size_t a, std::size_t b)
+		{
+			if (a != b && !(big[a] && big[b]))
+			{
+				edges.emplace(std::min(a, b), std::max(a, b));
+			}
+		};
+
+		auto order = Sequence(caves.size());
+		random.Shuffle(order);
+		for (auto i = 1U; i < order.size(); ++i)
+		{
+			auto other = order[static_cast<std::size_t>(random.Uniform(0, i - 1))];
+			if (big[order[i]] && big[other])
+			{
+				other = static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(size) - 1));
+			}
+			connect(order[i], other);
+		}
+		for (auto i = 0U; i < caves.size() / 2; ++i)
+		{
+			connect(static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(caves.size()) - 1)),
+			        static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(caves.size()) - 1)));
+		}
+
+		for (const auto &[a, b]: edges)
+		{
+			os << caves[a] << '-' << caves[b] << '\n';
+		}
+		for (auto i = 0U; i < 2; ++i)
+		{
+			os << "start-" << Pick(caves, random) << '\n';
+			os << Pick(caves, random) << "-end\n";
+		}
+	}
+
+	void GenerateOrigami(std::ostream &os, std::size_t size, Random &random)
+	{
+		// Folds of a real input, every fold halves a sheet of size 2 * line + 1 down to 40x6.
+		const std::vector<std::pair<char, std::int64_t>> folds{
+				{'x', 655}, {'y', 447}, {'x', 327}, {'y', 223}, {'x', 163}, {'y', 111},
+				{'x', 81}, {'y', 55}, {'x', 40}, {'y', 27}, {'y', 13}, {'y', 6}
+		};
+
+		// Start from dots of the folded sheet and unfold them, mirroring at random, so no dot lands on a fold.
+		for (auto i = 0U; i < size; ++i)
+		{
+			auto x = random.Uniform(0, 39);
+			auto y = random.Uniform(0, 5);
+			for (auto fold = folds.rbegin(); fold != folds.rend(); ++fold)
+			{
+				auto &coordinate = fold->first == 'x' ? x : y;
+				if (random.Chance(0.5))
+				{
+					coordinate = 2 * fold->second - coordinate;
+				}
+			}
+			os << x << ',' << y << '\n';
+		}
+
+		os << '\n';
+		for (const auto &[axis, line]: folds)
+		{
+			os << "fold along " << axis << '=' << line << '\n';
+		}
+	}
+
+	void GeneratePolymer(std::ostream &os, std::size_t size, Random &random)
+	{
+		constexpr std::string_view Elements = "BCFHKNOPSV";
+		const auto element = [&random, Elements]
+		{
+			return Elements[static_cast<std::size_t>(random.Uniform(0, Elements.size() - 1))];
+		};
+
+		for (auto i = 0U; i < size; ++i)
+		{
+			os << element();
+		}
+		os << "\n\n";
+
+		// Every pair needs a rule.
+		for (const auto first: Elements)
+		{
+			for (const auto second: Elements)
+			{
+				os << first << second << " -> " << element() << '\n';
+			}
+		}
+	}
+
+	void GenerateRisk(std::ostream &os, std::size_t size, Random &random)
+	{
+		WriteDigitGrid(os, size, size, 1, 9, random);
+	}
+
+	void AppendBits(std::string &bits, std::uint64_t value, std::size_t count)
+	{
+		for (auto i = count; i > 0; --i)
+		{
+			bits.push_back(((value >> (i - 1)) & 1) != 0 ? '1' : '0');
+		}
+	}
+
+	std::string GeneratePacket(std::size_t budget, std::size_t depth, Random &random)
+	{
+		std::string bits;
+		AppendBits(bits, static_cast<std::uint64_t>(random.Uniform(0, 7)), 3);
+
+		if (budget <= 1 || depth >= 16)
+		{
+			AppendBits(bits, 4, 3);
+			const auto groups = random.Uniform(1, 10);
+			for (auto group = groups; group > 0; --group)
+			{
+				AppendBits(bits, group == 1 ? 0 : 1, 1);
+				AppendBits(bits, static_cast<std::uint64_t>(random.Uniform(group == groups ? 1 : 0, 15)), 4);
+			}
+			return bits;
+		}
+
+		const std::array<std::uint64_t, 7> types{0, 1, 2, 3, 5, 6, 7};
+		const auto type = types[static_cast<std::size_t>(random.Uniform(0, 6))];
+		// Comparisons take exactly two operands, the other operators up to eight.
+		const auto children = type >= 5
+				? std::size_t{2}
+				: static_cast<std::size_t>(random.Uniform(1, static_cast<std::int64_t>(std::min<std::size_t>(budget, 8))));
+
+		std::vector<std::size_t> budgets(children, 1);
+		for (auto i = children; i < budget; ++i)
+		{
+			++budgets[static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(children) - 1))];
+		}
+
+		std::string payload;
+		for (const auto childBudget: budgets)
+		{
+			payload += GeneratePacket(childBudget, depth + 1, random);
+		}
+
+		AppendBits(bits, type, 3);
+		if (payload.size() < (1U << 15) && random.Chance(0.5))
+		{
+			AppendBits(bits, 0, 1);
+			AppendBits(bits, payload.size(), 15);
+		}
+		else
+		{
+			AppendBits(bits, 1, 1);
+			AppendBits(bits, children, 11);
+		}
+		return bits + payload;
+	}
+
+	void GeneratePackets(std::ostream &os, std::size_t size, Random &random)
+	{
+		auto bits = GeneratePacket(size, 0, random);
+		bits.resize((bits.size() + 7) / 8 * 8, '0');
+
+		constexpr std::string_view Hex = "0123456789ABCDEF";
+		for (auto i = 0U; i < bits.size(); i += 4)
+		{
+			os << Hex[std::stoul(bits.substr(i, 4), nullptr, 2)];
+		}
+		os << '\n';
+	}
+
+	void GenerateTarget(std::ostream &os, std::size_t size, Random &random)
+	{
+		// The x range is wide enough to contain a triangular number, so some probe stops above the target.
+		const auto distance = static_cast<std::int64_t>(size);
+		const auto x1 = 2 * distance + random.Uniform(0, distance / 4);
+		const auto y1 = -distance - random.Uniform(0, distance / 4);
+		os << "target area: x=" << x1 << ".." << x1 + distance / 2 << ", y=" << y1 << ".." << y1 + distance / 2 << '\n';
+	}
+
+	void GenerateSnailfish(std::ostream &os, std::size_t depth, Random &random)
+	{
+		if (depth == 4 || (depth > 0 && random.Chance(0.3)))
+		{
+			os << random.Uniform(0, 9);
+			return;
+		}
+		os << '[';
+		GenerateSnailfish(os, depth + 1, random);
+		os << ',';
+		GenerateSnailfish(os, depth + 1, random);
+		os << ']';
+	}
+
+	void GenerateSnailfishNumbers(std::ostream &os, std::size_t size, Random &random)
+	{
+		for (auto i = 0U; i < size; ++i)
+		{
+			GenerateSnailfish(os, 0, random);
+			os << '\n';
+		}
+	}
+
+	std::vector<std::pair<std::array<std::size_t, 3>, Point>> Rotations()
+	{
+		// The 24 signed axis permutations with determinant +1.
+		std::vector<std::pair<std::array<std::size_t, 3>, Point>> result;
+		std::array<std::size_t, 3> axes{0, 1, 2};
+		do
+		{
+			const auto inversions = (axes[0] > axes[1]) + (axes[0] > axes[2]) + (axes[1] > axes[2]);
+			for (auto signs = 0U; signs < 8; ++signs)
+			{
+				const Point sign{(signs & 1) ? -1 : 1, (signs & 2) ? -1 : 1, (signs & 4) ? -1 : 1};
+				const auto parity = (inversions % 2 == 0 ? 1 : -1) * sign[0] * sign[1] * sign[2];
+				if (parity == 1)
+				{
+					result.emplace_back(axes, sign);
+				}
+			}
+		}
+		while (std::next_permutation(axes.begin(), axes.end()));
+		return result;
+	}
+
+	void GenerateScanners(std::ostream &os, std::size_t size, Random &random)
+	{
+		constexpr std::int64_t Range = 1000;
+		const auto inRange = [Range](const Point &scanner, const Point &beacon)
+		{
+			return std::abs(beacon[0] - scanner[0]) <= Range && std::abs(beacon[1] - scanner[1]) <= Range &&
+			       std::abs(beacon[2] - scanner[2]) <= Range;
+		};
+
+		std::vector<Point> scanners{{0, 0, 0}};
+		std::set<Point> beacons;
+		const auto addBeacons = [&](const Point &low, const Point &high, std::size_t count)
+		{
+			for (auto i = 0U; i < count; ++i)
+			{
+				beacons.insert({random.Uniform(low[0], high[0]), random.Uniform(low[1], high[1]), random.Uniform(low[2], high[2])});
+			}
+		};
+		addBeacons({-Range, -Range, -Range}, {Range, Range, Range}, 14);
+
+		// Every new scanner overlaps an earlier one and shares at least 12 beacons with it.
+		while (scanners.size() < size)
+		{
+			const auto parent = Pick(scanners, random);
+			Point scanner = parent;
+			const auto mainAxis = static_cast<std::size_t>(random.Uniform(0, 2));
+			for (auto axis = 0U; axis < 3; ++axis)
+			{
+				const auto offset = axis == mainAxis ? random.Uniform(900, 1200) : random.Uniform(0, 300);
+				scanner[axis] += random.Chance(0.5) ? offset : -offset;
+			}
+			if (std::find(scanners.begin(), scanners.end(), scanner) != scanners.end())
+			{
+				continue;
+			}
+
+			Point low{};
+			Point high{};
+			for (auto axis = 0U; axis < 3; ++axis)
+			{
+				low[axis] = std::max(parent[axis], scanner[axis]) - Range;
+				high[axis] = std::min(parent[axis], scanner[axis]) + Range;
+			}
+			addBeacons(low, high, 12);
+			addBeacons({scanner[0] - Range, scanner[1] - Range, scanner[2] - Range},
+			           {scanner[0] + Range, scanner[1] + Range, scanner[2] + Range}, 14);
+			scanners.push_back(scanner);
+		}
+
+		const auto rotations = Rotations();
+		for (auto i = 0U; i < scanners.size(); ++i)
+		{
+			const auto &[axes, sign] = i == 0 ? rotations.front() : Pick(rotations, random);
+			std::vector<Point> visible;
+			for (const auto &beacon: beacons)
+			{
+				if (inRange(scanners[i], beacon))
+				{
+					Point relative{};
+					for (auto axis = 0U; axis < 3; ++axis)
+					{
+						relative[axis] = sign[axis] * (beacon[axes[axis]] - scanners[i][axes[axis]]);
+					}
+					visible.push_back(relative);
+				}
+			}
+			random.Shuffle(visible);
+
+			os << (i == 0 ? "" : "\n") << "--- scanner " << i << " ---\n";
+			for (const auto &beacon: visible)
+			{
+				os << beacon[0] << ',' << beacon[1] << ',' << beacon[2] << '\n';
+			}
+		}
+	}
+
+	void GenerateImage(std::ostream &os, std::size_t size, Random &random)
+	{
+		// A lit first entry makes the infinite background blink, as in the real inputs.
+		std::string algorithm(512, '.');
+		for (auto &c: algorithm)
+		{
+			c = random.Chance(0.5) ? '#' : '.';
+		}
+		algorithm.front() = '#';
+		algorithm.back() = '.';
+		os << algorithm << "\n\n";
+
+		std::string line(size, '.');
+		for (auto y = 0U; y < size; ++y)
+		{
+			for (auto &c: line)
+			{
+				c = random.Chance(0.5) ? '#' : '.';
+			}
+			os << line << '\n';
+		}
+	}
+
+	void GenerateDirac(std::ostream &os, std::size_t, Random &random)
+	{
+		os << "Player 1 starting position: " << random.Uniform(1, 10) << '\n';
+		os << "Player 2 starting position: " << random.Uniform(1, 10) << '\n';
+	}
+
+	void GenerateReboot(std::ostream &os, std::size_t size, Random &random)
+	{
+		for (auto i = 0U; i < size; ++i)
+		{
+			// The first twenty steps stay inside the initialization region like in the real inputs.
+			const auto initialization = i < 20;
+			os << (i == 0 || random.Chance(0.7) ? "on" : "off");
+			for (const auto axis: {'x', 'y', 'z'})
+			{
+				const auto low = initialization ? random.Uniform(-50, 40) : random.Uniform(-100000, 90000);
+				const auto high = low + (initialization ? random.Uniform(0, 50 - low) : random.Uniform(5000, 40000));
+				os << (axis == 'x' ? " " : ",") << axis << '=' << low << ".." << high;
+			}
+			os << '\n';
+		}
+	}
+
+	void GenerateAmphipods(std::ostream &os, std::size_t, Random &random)
+	{
+		std::vector<char> amphipods{'A', 'A', 'B', 'B', 'C', 'C', 'D', 'D'};
+		random.Shuffle(amphipods);
+		os << "#############\n";
+		os << "#...........#\n";
+		os << "###" << amphipods[0] << '#' << amphipods[1] << '#' << amphipods[2] << '#' << amphipods[3] << "###\n";
+		os << "  #" << amphipods[4] << '#' << amphipods[5] << '#' << amphipods[6] << '#' << amphipods[7] << "#\n";
+		os << "  #########\n";
+	}
+
+	void GenerateMonad(std::ostream &os, std::size_t size, Random &random)
+	{
+		// MONAD is a base 26 stack: every digit either pushes w + b or pops and requires w == top + a.
+		// The pushes and pops form a random balanced sequence of size pairs, each pair constraining its two
+		// digits to differ by a delta in [-8, 8] so that a valid model number always exists.
+		std::vector<bool> pushes;
+		for (auto open = size, depth = std::size_t{0}; open > 0 || depth > 0;)
+		{
+			const auto push = open > 0 && (depth == 0 || random.Chance(0.5));
+			pushes.push_back(push);
+			open -= push ? 1 : 0;
+			depth = push ? depth + 1 : depth - 1;
+		}
+
+		std::vector<std::int64_t> stack;
+		for (const auto push: pushes)
+		{
+			std::int64_t a;
+			std::int64_t b = random.Uniform(1, 16);
+			if (push)
+			{
+				a = random.Uniform(10, 16);
+				stack.push_back(b);
+			}
+			else
+			{
+				a = random.Uniform(-8, 8) - stack.back();
+				stack.pop_back();
+			}
+
+			os << "inp w\nmul x 0\nadd x z\nmod x 26\n";
+			os << "div z " << (push ? 1 : 26) << '\n';
+			os << "add x " << a << '\n';
+			os << "eql x w\neql x 0\nmul y 0\nadd y 25\nmul y x\nadd y 1\nmul z y\nmul y 0\nadd y w\n";
+			os << "add y " << b << '\n';
+			os << "mul y x\nadd z y\n";
+		}
+	}
+
+	void GenerateCucumbers(std::ostream &os, std::size_t size, Random &random)
+	{
+		std::string line(size, '.');
+		for (auto y = 0U; y < size; ++y)
+		{
+			for (auto &c: line)
+			{
+				const auto kind = random.Uniform(0, 2);
+				c = kind == 0 ? '>' : (kind == 1 ? 'v' : '.');
+			}
+			os << line << '\n';
+		}
+	}
+
+	const std::array<Generator, 25> Generators{{
+			{"lines", 2000, 4, 50'000'000, GenerateDepths},
+			{"lines", 1000, 1, 50'000'000, GenerateCommands},
+			{"lines", 1000, 1, 4096, GenerateDiagnostic},
+			{"boards", 100, 1, 1'000'000, GenerateBingo},
+			{"lines", 500, 1, 10'000'000, GenerateVents},
+			{"fish", 300, 1, 10'000'000, GenerateLanternfish},
+			{"crabs", 1000, 1, 10'000'000, GenerateCrabs},
+			{"lines", 200, 1, 10'000'000, GenerateSegments},
+			{"grid side", 100, 1, 20'000, GenerateHeightmap},
+			{"lines", 100, 1, 10'000'000, GenerateBrackets},
+			{"fixed 10x10 grid", 10, 10, 10, GenerateOctopuses},
+			{"small caves", 10, 2, 676, GenerateCaves},
+			{"dots", 800, 1, 10'000'000, GenerateOrigami},
+			{"template length", 20, 2, 10'000'000, GeneratePolymer},
+			{"grid side", 100, 2, 20'000, GenerateRisk},
+			{"literal packets", 300, 1, 1'000'000, GeneratePackets},
+			{"target distance", 100, 24, 100'000, GenerateTarget},
+			{"numbers", 100, 2, 1'000'000, GenerateSnailfishNumbers},
+			{"scanners", 30, 1, 1000, GenerateScanners},
+			{"image side", 100, 1, 20'000, GenerateImage},
+			{"fixed", 1, 1, 1, GenerateDirac},
+			{"steps", 420, 1, 1'000'000, GenerateReboot},
+			{"fixed", 1, 1, 1, GenerateAmphipods},
+			{"digit pairs", 7, 1, 7, GenerateMonad},
+			{"grid side", 139, 1, 20'000, GenerateCucumbers},
+	}};
+}
+
+const Generator &GetGenerator(std::size_t day)
+{
+	if (day < 1 || day > Generators.size())
+	{
+		throw std::runtime_error("Invalid day");
+	}
+	return Generators[day - 1];
+}
@@ -0,0 +1,25 @@
+#ifndef ADVENTOFCODE2021_GENERATORS_HPP
+#define ADVENTOFCODE2021_GENERATORS_HPP
+
+#include "Random.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+struct Generator
+{
+	// What the size parameter counts, e.g. "lines" or "grid side".
+	std::string_view unit;
+	// Roughly the size of a real puzzle input.
+	std::size_t defaultSize;
+	// Sizes are clamped to this range, outside of it the format or the solver does not allow valid inputs.
+	std::size_t minSize;
+	std::size_t maxSize;
+	void (*generate)(std::ostream &os, std::size_t size, Random &random);
+};
+
+// Throws for days outside 1..25.
+[[nodiscard]] const Generator &GetGenerator(std::size_t day);
+
+#endif //ADVENTOFCODE2021_GENERATORS_HPP
@@ -0,0 +1,44 @@
+#ifndef ADVENTOFCODE2021_RANDOM_HPP
+#define ADVENTOFCODE2021_RANDOM_HPP
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Seeded random source for the generators. Only the raw std::mt19937_64 output is used, the standard
+// distributions are implementation defined and would give different inputs on different standard libraries.
+class Random
+{
+public:
+	explicit Random(std::uint64_t seed)
+			: _engine(seed)
+	{}
+
+	// Uniform value in [low, high].
+	std::int64_t Uniform(std::int64_t low, std::int64_t high)
+	{
+		const auto range = static_cast<std::uint64_t>(high - low) + 1;
+		return low + static_cast<std::int64_t>(_engine() % range);
+	}
+
+	bool Chance(double probability)
+	{
+		return static_cast<double>(_engine() >> 11) * 0x1.0p-53 < probability;
+	}
+
+	template<class T>
+	void Shuffle(std::vector<T> &values)
+	{
+		using std::swap;
+		for (auto i = values.size(); i > 1; --i)
+		{
+			swap(values[i - 1], values[static_cast<std::size_t>(Uniform(0, static_cast<std::int64_t>(i - 1)))]);
+		}
+	}
+
+private:
+	std::mt19937_64 _engine;
+};
+
+#endif //ADVENTOFCODE2021_RANDOM_HPP
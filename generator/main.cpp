@@ -0,0 +1,118 @@
+#include "Generators.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	std::uint64_t ParseNumber(std::string_view value)
+	{
+		std::uint64_t result{};
+		const auto res = std::from_chars(value.data(), value.data() + value.size(), result);
+		if (res.ec != std::errc() || res.ptr != value.data() + value.size())
+		{
+			throw std::runtime_error("Invalid numeric argument");
+		}
+		return result;
+	}
+
+	void PrintGenerators()
+	{
+		for (auto day = 1U; day <= 25; ++day)
+		{
+			const auto &generator = GetGenerator(day);
+			std::cout << "day" << day << ": " << generator.unit << ", default " << generator.defaultSize
+			          << ", range " << generator.minSize << ".." << generator.maxSize << "\r\n";
+		}
+	}
+}
+
+// Writes a synthetic puzzle input for one day.
+// Usage: aoc_gen [--size N | --scale N] [--seed N] [--output PATH] DAY
+//        aoc_gen --list
+// --scale multiplies the generator's default (puzzle sized) size. The chosen size goes to stderr.
+int main(int argc, char **argv)
+{
+	std::optional<std::uint64_t> size;
+	std::uint64_t scale = 1;
+	std::uint64_t seed = 1;
+	std::optional<std::string> output;
+	std::optional<std::uint64_t> day;
+
+	for (auto i = 1; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		const auto next = [&]() -> std::string_view
+		{
+			if (i + 1 >= argc)
+			{
+				throw std::runtime_error("Missing value for argument");
+			}
+			return argv[++i];
+		};
+
+		if (argument == "--list")
+		{
+			PrintGenerators();
+			return 0;
+		}
+		else if (argument == "--size")
+		{
+			size = ParseNumber(next());
+		}
+		else if (argument == "--scale")
+		{
+			scale = ParseNumber(next());
+		}
+		else if (argument == "--seed")
+		{
+			seed = ParseNumber(next());
+		}
+		else if (argument == "--output")
+		{
+			output = std::string{next()};
+		}
+		else if (argument.starts_with("--"))
+		{
+			throw std::runtime_error("Unknown argument");
+		}
+		else
+		{
+			day = ParseNumber(argument.starts_with("day") ? argument.substr(3) : argument);
+		}
+	}
+
+	if (!day.has_value())
+	{
+		throw std::runtime_error("Not enough input arguments");
+	}
+
+	const auto &generator = GetGenerator(*day);
+	const auto effectiveSize = std::clamp<std::uint64_t>(size.value_or(generator.defaultSize * scale),
+	                                                     generator.minSize, generator.maxSize);
+	std::cerr << "day" << *day << ": " << effectiveSize << " " << generator.unit << ", seed " << seed << "\r\n";
+
+	Random random{seed};
+	if (output.has_value())
+	{
+		std::ofstream file(*output);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		generator.generate(file, effectiveSize, random);
+	}
+	else
+	{
+		std::ios::sync_with_stdio(false);
+		generator.generate(std::cout, effectiveSize, random);
+	}
+
+	return 0;
+}
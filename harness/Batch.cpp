@@ -0,0 +1,238 @@
+#include "Batch.hpp"
+#include "Instrumentation.hpp"
+#include "Solver.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	struct BatchRun
+	{
+		ResultValues results;
+		std::string error;
+		std::size_t bytes = 0;
+		// Loading and solving the input, measured by the worker that picked it up.
+		std::chrono::nanoseconds elapsed{};
+	};
+
+	void AppendInput(const std::filesystem::path &path, std::vector<std::string> &inputs)
+	{
+		if (!std::filesystem::is_directory(path))
+		{
+			inputs.push_back(path.string());
+			return;
+		}
+
+		std::vector<std::string> files;
+		for (const auto &entry: std::filesystem::directory_iterator(path))
+		{
+			if (entry.is_regular_file())
+			{
+				files.push_back(entry.path().string());
+			}
+		}
+		std::sort(files.begin(), files.end());
+		inputs.insert(inputs.end(), files.begin(), files.end());
+	}
+
+	void PrintRun(std::ostream &os, const std::string &input, const BatchRun &run)
+	{
+		os << input << ":";
+		if (!run.error.empty())
+		{
+			os << " failed: " << run.error << "\r\n";
+			return;
+		}
+		for (auto i = 0U; i < run.results.size(); ++i)
+		{
+			const auto &[name, value] = run.results[i];
+			os << (i == 0 ? " " : ", ") << name << " result:"
+			   << (value.find('\n') != std::string::npos ? "\r\n" : " ") << value;
+		}
+		os << "\r\n";
+	}
+
+	void WriteBatchJson(std::ostream &os, const std::string &name, const std::vector<std::string> &inputs,
+	                    const std::vector<BatchRun> &runs, std::size_t jobs, std::chrono::nanoseconds wall,
+	                    const PhaseStatistics &latency, double inputsPerSecond)
+	{
+		std::size_t bytes = 0;
+		std::size_t failed = 0;
+		for (const auto &run: runs)
+		{
+			bytes += run.bytes;
+			failed += run.error.empty() ? 0 : 1;
+		}
+
+		os << "{\n";
+		os << "  \"name\": \"" << EscapeJson(name) << "\",\n";
+		os << "  \"batch\": true,\n";
+		os << "  \"jobs\": " << jobs << ",\n";
+		os << "  \"inputs\": " << inputs.size() << ",\n";
+		os << "  \"failed\": " << failed << ",\n";
+		os << "  \"input_bytes\": " << bytes << ",\n";
+		os << "  \"wall_ns\": " << wall.count() << ",\n";
+		os << "  \"inputs_per_second\": " << inputsPerSecond << ",\n";
+		os << "  \"latency\": {\"min_ns\": " << latency.min.count() << ", \"median_ns\": " << latency.median.count()
+		   << ", \"p99_ns\": " << latency.p99.count() << ", \"mean_ns\": " << latency.mean.count() << "},\n";
+		os << "  \"runs\": [\n";
+		for (auto i = 0U; i < runs.size(); ++i)
+		{
+			const auto &run = runs[i];
+			os << "    {\"input\": \"" << EscapeJson(inputs[i]) << "\", \"elapsed_ns\": " << run.elapsed.count();
+			if (!run.error.empty())
+			{
+				os << ", \"error\": \"" << EscapeJson(run.error) << "\"";
+			}
+			else
+			{
+				os << ", \"results\": {";
+				for (auto j = 0U; j < run.results.size(); ++j)
+				{
+					os << (j == 0 ? "" : ", ") << "\"" << EscapeJson(run.results[j].first) << "\": \""
+					   << EscapeJson(run.results[j].second) << "\"";
+				}
+				os << "}";
+			}
+			os << "}" << (i + 1 == runs.size() ? "\n" : ",\n");
+		}
+		os << "  ]\n";
+		os << "}\n";
+	}
+}
+
+std::vector<std::string> ExpandBatchInputs(const HarnessOptions &options)
+{
+	std::vector<std::string> inputs;
+	for (const auto &input: options.batchInputs)
+	{
+		AppendInput(input, inputs);
+	}
+
+	if (options.manifestPath.has_value())
+	{
+		std::ifstream manifest(*options.manifestPath);
+		if (!manifest.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		const auto directory = std::filesystem::path{*options.manifestPath}.parent_path();
+		std::string line;
+		while (std::getline(manifest, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.pop_back();
+			}
+			if (line.empty() || line.front() == '#')
+			{
+				continue;
+			}
+			AppendInput(directory / line, inputs);
+		}
+	}
+
+	if (inputs.empty())
+	{
+		throw std::runtime_error("No inputs in batch");
+	}
+	return inputs;
+}
+
+int RunBatch(const std::string &name, const HarnessOptions &options, const std::function<void(Harness &)> &registration)
+{
+	const auto inputs = ExpandBatchInputs(options);
+	SetDefaultPoolSize(options.threads == 0 ? 1 : options.threads);
+	const auto hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	const auto jobs = std::min(options.jobs == 0 ? hardware : options.jobs, inputs.size());
+
+	const auto persistent = std::make_shared<PersistentState>();
+	std::vector<BatchRun> runs(inputs.size());
+	std::atomic<std::size_t> next = 0;
+
+	const auto begin = Clock::now();
+	{
+		// Workers pull inputs one at a time, so a few large inputs do not hold up a whole share.
+		ThreadPool pool{jobs};
+		for (auto worker = 0U; worker < jobs; ++worker)
+		{
+			pool.Submit([&name, &registration, &persistent, &inputs, &runs, &next]
+			            {
+				            Solver solver{name, registration, persistent};
+
+				            for (auto i = next++; i < inputs.size(); i = next++)
+				            {
+					            auto &run = runs[i];
+					            const auto start = Clock::now();
+					            try
+					            {
+						            auto input = std::make_shared<InputFile>(inputs[i]);
+						            run.bytes = input->Contents().size();
+						            run.results = solver.Solve(std::move(input));
+					            }
+					            catch (const std::exception &e)
+					            {
+						            run.error = e.what();
+					            }
+					            run.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+				            }
+			            });
+		}
+		pool.Wait();
+	}
+	const auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
+
+	std::size_t bytes = 0;
+	std::size_t failed = 0;
+	std::vector<std::chrono::nanoseconds> latencies;
+	latencies.reserve(runs.size());
+	for (auto i = 0U; i < runs.size(); ++i)
+	{
+		PrintRun(std::cout, inputs[i], runs[i]);
+		bytes += runs[i].bytes;
+		failed += runs[i].error.empty() ? 0 : 1;
+		latencies.push_back(runs[i].elapsed);
+	}
+
+	const auto seconds = static_cast<double>(wall.count()) / 1e9;
+	const auto inputsPerSecond = seconds == 0.0 ? 0.0 : static_cast<double>(inputs.size()) / seconds;
+	const auto latency = Summarize(latencies);
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "Batch: " << inputs.size() << " inputs, " << failed << " failed, "
+	          << static_cast<double>(bytes) / 1e6 << " MB in " << seconds * 1e3 << "ms on " << jobs << " workers\r\n";
+	std::cout << "Throughput: " << inputsPerSecond << " inputs/s, "
+	          << (seconds == 0.0 ? 0.0 : static_cast<double>(bytes) / seconds / 1e6) << " MB/s\r\n";
+	std::cout << "Per input: min " << static_cast<double>(latency.min.count()) / 1e3 << "us, median "
+	          << static_cast<double>(latency.median.count()) / 1e3 << "us, p99 "
+	          << static_cast<double>(latency.p99.count()) / 1e3 << "us\r\n";
+	std::cout << std::defaultfloat;
+
+	if constexpr (instrumentation::Enabled())
+	{
+		std::cout << "Instrumentation, totals over " << inputs.size() << " inputs:\r\n";
+		instrumentation::WriteReport(std::cout, name + ".");
+	}
+
+	if (options.jsonPath.has_value())
+	{
+		std::ofstream file(*options.jsonPath);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		WriteBatchJson(file, name, inputs, runs, jobs, wall, latency, inputsPerSecond);
+	}
+
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+#ifndef ADVENTOFCODE2021_BATCH_HPP
+#define ADVENTOFCODE2021_BATCH_HPP
+
+#include "Harness.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Inputs of a batch run in order: files as given, the regular files of directories sorted by name and
+// the lines of the manifest. Manifest paths are relative to the manifest, blank lines and lines starting
+// with '#' are skipped.
+[[nodiscard]] std::vector<std::string> ExpandBatchInputs(const HarnessOptions &options);
+
+// Solves many inputs of one day in a single process. Each of the --jobs workers registers the day once
+// and keeps its harness, so the solver state the registration allocates is reused for every input it
+// picks up, and all workers share one PersistentState for memo tables. The solvers' own pool defaults
+// to a single thread, the parallelism comes from the inputs. Prints the results per input and the
+// throughput in inputs per second, returns 1 if any input failed.
+int RunBatch(const std::string &name, const HarnessOptions &options, const std::function<void(Harness &)> &registration);
+
+#endif //ADVENTOFCODE2021_BATCH_HPP
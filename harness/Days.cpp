@@ -0,0 +1,53 @@
+#include "Days.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+	constexpr std::array<Day, 25> Days{{
+			{"day1", day1::Register, day1::Pack},
+			{"day2", day2::Register, nullptr},
+			{"day3", day3::Register, nullptr},
+			{"day4", day4::Register, nullptr},
+			{"day5", day5::Register, day5::Pack},
+			{"day6", day6::Register, nullptr},
+			{"day7", day7::Register, nullptr},
+			{"day8", day8::Register, nullptr},
+			{"day9", day9::Register, day9::Pack},
+			{"day10", day10::Register, nullptr},
+			{"day11", day11::Register, day11::Pack},
+			{"day12", day12::Register, nullptr},
+			{"day13", day13::Register, nullptr},
+			{"day14", day14::Register, nullptr},
+			{"day15", day15::Register, day15::Pack},
+			{"day16", day16::Register, nullptr},
+			{"day17", day17::Register, nullptr},
+			{"day18", day18::Register, nullptr},
+			{"day19", day19::Register, day19::Pack},
+			{"day20", day20::Register, day20::Pack},
+			{"day21", day21::Register, nullptr},
+			{"day22", day22::Register, day22::Pack},
+			{"day23", day23::Register, nullptr},
+			{"day24", day24::Register, nullptr},
+			{"day25", day25::Register, nullptr},
+	}};
+}
+
+const std::array<Day, 25> &AllDays()
+{
+	return Days;
+}
+
+const Day &FindDay(std::string_view name)
+{
+	const auto day = std::find_if(Days.begin(), Days.end(), [name](const Day &d)
+	{
+		return d.name == name || d.name.substr(3) == name;
+	});
+	if (day == Days.end())
+	{
+		throw std::runtime_error("Unknown day");
+	}
+	return *day;
+}
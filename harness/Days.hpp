@@ -0,0 +1,55 @@
+#ifndef ADVENTOFCODE2021_DAYS_HPP
+#define ADVENTOFCODE2021_DAYS_HPP
+
+#include "Harness.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+// Every day is built as a dayN_lib that registers its phases with a Harness. The dayN executables
+// and aoc_all are thin wrappers around these, aoc_all and aoc_server go through the AllDays table.
+// To embed a day in another process, construct a Solver from its name and registration.
+// Days with a Pack function also parse the packed inputs aoc_pack writes, see PackedInput.hpp.
+
+namespace day1 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day2 { void Register(Harness &harness); }
+namespace day3 { void Register(Harness &harness); }
+namespace day4 { void Register(Harness &harness); }
+namespace day5 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day6 { void Register(Harness &harness); }
+namespace day7 { void Register(Harness &harness); }
+namespace day8 { void Register(Harness &harness); }
+namespace day9 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day10 { void Register(Harness &harness); }
+namespace day11 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day12 { void Register(Harness &harness); }
+namespace day13 { void Register(Harness &harness); }
+namespace day14 { void Register(Harness &harness); }
+namespace day15 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day16 { void Register(Harness &harness); }
+namespace day17 { void Register(Harness &harness); }
+namespace day18 { void Register(Harness &harness); }
+namespace day19 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day20 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day21 { void Register(Harness &harness); }
+namespace day22 { void Register(Harness &harness); std::string Pack(const InputFile &input); }
+namespace day23 { void Register(Harness &harness); }
+namespace day24 { void Register(Harness &harness); }
+namespace day25 { void Register(Harness &harness); }
+
+struct Day
+{
+	std::string_view name;
+	void (*registration)(Harness &harness);
+	// Converts a text input to the day's packed binary input, null for days without one.
+	std::string (*pack)(const InputFile &input);
+};
+
+// Every day in order, linked from days_lib.
+[[nodiscard]] const std::array<Day, 25> &AllDays();
+
+// Looks a day up by "dayN" or "N", throws for unknown names.
+[[nodiscard]] const Day &FindDay(std::string_view name);
+
+#endif //ADVENTOFCODE2021_DAYS_HPP
@@ -0,0 +1,875 @@
+#include "Harness.hpp"
+#include "Batch.hpp"
+#include "Instrumentation.hpp"
+#include "Hash.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+#include <sys/resource.h>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Results are only stored when solving took this many times longer than looking them up, a hit on a
+	// fast day would cost more than solving it again.
+	constexpr auto MinSolveToLookupRatio = 4;
+
+	std::size_t ParseCount(std::string_view value)
+	{
+		std::size_t result{};
+		const auto res = std::from_chars(value.data(), value.data() + value.size(), result);
+		if (res.ec != std::errc() || res.ptr != value.data() + value.size())
+		{
+			throw std::runtime_error("Invalid numeric argument");
+		}
+		return result;
+	}
+
+	std::string FormatMicroseconds(std::chrono::nanoseconds value)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(1) << static_cast<double>(value.count()) / 1000.0 << "us";
+		return stream.str();
+	}
+
+	template<class Sample, class Projection>
+	auto Median(const std::vector<Sample> &samples, Projection projection)
+	{
+		std::vector<std::decay_t<std::invoke_result_t<Projection, const Sample &>>> values;
+		values.reserve(samples.size());
+		for (const auto &sample: samples)
+		{
+			values.push_back(projection(sample));
+		}
+		std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>((values.size() - 1) / 2), values.end());
+		return values[(values.size() - 1) / 2];
+	}
+
+	std::uint64_t PerfMedian(const std::vector<std::array<std::uint64_t, PerfEventCount>> &samples, std::size_t event)
+	{
+		return Median(samples, [event](const auto &sample)
+		{
+			return sample[event];
+		});
+	}
+
+	AllocationStatistics AllocationDelta(const AllocationStatistics &begin, const AllocationStatistics &end)
+	{
+		return {
+				end.allocations - begin.allocations,
+				end.deallocations - begin.deallocations,
+				end.bytes - begin.bytes,
+				end.liveBytes - begin.liveBytes,
+				end.peakLiveBytes - begin.liveBytes
+		};
+	}
+
+	long PeakRssKilobytes()
+	{
+		rusage usage{};
+		getrusage(RUSAGE_SELF, &usage);
+		return usage.ru_maxrss;
+	}
+
+	void WriteStatistics(std::ostream &os, const PhaseStatistics &statistics)
+	{
+		os << "\"min_ns\": " << statistics.min.count()
+		   << ", \"median_ns\": " << statistics.median.count()
+		   << ", \"p99_ns\": " << statistics.p99.count()
+		   << ", \"mean_ns\": " << statistics.mean.count();
+	}
+}
+
+HarnessOptions ParseHarnessOptions(int argc, char **argv)
+{
+	HarnessOptions options{};
+	auto cache = false;
+	std::vector<std::string> inputs;
+	for (auto i = 1; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		const auto next = [&]() -> std::string_view
+		{
+			if (i + 1 >= argc)
+			{
+				throw std::runtime_error("Missing value for argument");
+			}
+			return argv[++i];
+		};
+
+		if (argument == "--warmup")
+		{
+			options.warmup = ParseCount(next());
+		}
+		else if (argument == "--iterations")
+		{
+			options.iterations = ParseCount(next());
+		}
+		else if (argument == "--json")
+		{
+			options.jsonPath = std::string{next()};
+		}
+		else if (argument == "--cold")
+		{
+			options.coldLoad = true;
+		}
+		else if (argument == "--perf")
+		{
+			options.perfCounters = true;
+		}
+		else if (argument == "--cache")
+		{
+			cache = true;
+		}
+		else if (argument == "--no-cache")
+		{
+			cache = false;
+		}
+		else if (argument == "--cache-dir")
+		{
+			options.cacheDirectory = std::string{next()};
+		}
+		else if (argument == "--threads")
+		{
+			options.threads = ParseCount(next());
+		}
+		else if (argument == "--stream")
+		{
+			options.stream = true;
+		}
+		else if (argument == "--batch")
+		{
+			options.batch = true;
+		}
+		else if (argument == "--manifest")
+		{
+			options.batch = true;
+			options.manifestPath = std::string{next()};
+		}
+		else if (argument == "--jobs")
+		{
+			options.jobs = ParseCount(next());
+		}
+		else if (argument.starts_with("--"))
+		{
+			throw std::runtime_error("Unknown argument");
+		}
+		else
+		{
+			inputs.emplace_back(argument);
+		}
+	}
+
+	// Hardware counters and allocation counts only see the thread that runs the phases, work the solvers
+	// hand to pool workers would be missing and vary with scheduling.
+	if (options.perfCounters || AllocationTrackingEnabled())
+	{
+		options.threads = 1;
+	}
+
+	if (options.batch)
+	{
+		if (inputs.empty() && !options.manifestPath.has_value())
+		{
+			throw std::runtime_error("Not enough input arguments");
+		}
+		if (options.stream || options.warmup > 0 || options.iterations > 1 || options.coldLoad || options.perfCounters)
+		{
+			throw std::runtime_error("Batch mode solves every input once");
+		}
+		options.batchInputs = std::move(inputs);
+		return options;
+	}
+
+	if (inputs.empty())
+	{
+		throw std::runtime_error("Not enough input arguments");
+	}
+	options.inputPath = inputs.back();
+	if (options.iterations == 0)
+	{
+		throw std::runtime_error("At least one iteration is required");
+	}
+	if (options.stream && (options.warmup > 0 || options.iterations > 1 || options.coldLoad))
+	{
+		throw std::runtime_error("Streaming runs a single iteration");
+	}
+	options.resultCache = cache && !options.stream && options.warmup == 0 && options.iterations == 1 && !options.coldLoad &&
+	                      !options.perfCounters;
+	return options;
+}
+
+PhaseStatistics Summarize(std::vector<std::chrono::nanoseconds> samples)
+{
+	if (samples.empty())
+	{
+		return {};
+	}
+	std::sort(samples.begin(), samples.end());
+
+	const auto rank = [&samples](double percentile)
+	{
+		const auto index = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(samples.size())));
+		return samples[std::clamp<std::size_t>(index, 1, samples.size()) - 1];
+	};
+
+	const auto total = std::accumulate(samples.begin(), samples.end(), std::chrono::nanoseconds{});
+	return {
+			samples.front(),
+			rank(0.5),
+			rank(0.99),
+			total / static_cast<std::int64_t>(samples.size())
+	};
+}
+
+std::string EscapeJson(std::string_view str)
+{
+	std::string result;
+	result.reserve(str.size());
+	for (const auto c: str)
+	{
+		switch (c)
+		{
+			case '"':
+				result += "\\\"";
+				break;
+			case '\\':
+				result += "\\\\";
+				break;
+			case '\n':
+				result += "\\n";
+				break;
+			case '\r':
+				result += "\\r";
+				break;
+			case '\t':
+				result += "\\t";
+				break;
+			default:
+				result.push_back(c);
+		}
+	}
+	return result;
+}
+
+Harness::Harness(std::string name, HarnessOptions options)
+		: _name(std::move(name)), _options(std::move(options))
+{
+	_phaseNames.emplace_back("Load");
+}
+
+void Harness::AddPhase(std::string name, Harness::Phase phase)
+{
+	_phaseNames.push_back(std::move(name));
+	_phases.push_back(std::move(phase));
+}
+
+void Harness::AddResult(std::string name, Harness::Result result)
+{
+	_results.emplace_back(std::move(name), std::move(result));
+}
+
+void Harness::Run()
+{
+	_samples.assign(_phaseNames.size(), {});
+	_totals.clear();
+	_coldLoad.reset();
+	_runs = 0;
+	_cachedResults.reset();
+	_cacheLookup.reset();
+	_cacheError.clear();
+	_streamResults.reset();
+
+	if (_options.stream)
+	{
+		RunStream();
+		return;
+	}
+
+	CacheKey cacheKey;
+	const auto cache = LookupResults(cacheKey);
+	if (_cachedResults.has_value())
+	{
+		return;
+	}
+
+	_perf.reset();
+	_perfSamples.assign(_phaseNames.size(), {});
+	_allocationSamples.assign(_phaseNames.size(), {});
+	if (_options.perfCounters)
+	{
+		// Opened here so the counters follow the thread that runs the phases.
+		_perf.emplace();
+	}
+
+	auto warmup = _options.warmup;
+	if (_options.coldLoad && !_resident)
+	{
+		EvictFromPageCache(_options.inputPath);
+		RunIteration(false);
+		warmup = warmup > 0 ? warmup - 1 : 0;
+	}
+
+	for (auto i = 0U; i < warmup; ++i)
+	{
+		RunIteration(false);
+	}
+
+	for (auto i = 0U; i < _options.iterations; ++i)
+	{
+		RunIteration(true);
+	}
+
+	if (cache && _totals.back() > *_cacheLookup * MinSolveToLookupRatio)
+	{
+		try
+		{
+			cache->Store(cacheKey, Results());
+		}
+		catch (const std::exception &e)
+		{
+			_cacheError = e.what();
+		}
+	}
+}
+
+std::unique_ptr<ResultCache> Harness::LookupResults(CacheKey &key)
+{
+	if (!_options.resultCache || _solverVersion.empty())
+	{
+		return nullptr;
+	}
+
+	// A broken cache directory only costs the lookup, the solvers still run.
+	try
+	{
+		const auto begin = Clock::now();
+		if (!_resident)
+		{
+			_input = std::make_shared<InputFile>(_options.inputPath);
+			_inputSize = _input->Contents().size();
+		}
+		key = {_name, _solverVersion, HashBytes(_input->Contents()), _inputSize};
+
+		auto cache = std::make_unique<ResultCache>(_options.cacheDirectory.has_value()
+		                                           ? std::filesystem::path{*_options.cacheDirectory}
+		                                           : ResultCache::DefaultDirectory());
+		_cachedResults = cache->Find(key);
+		_cacheLookup = Clock::now() - begin;
+		return cache;
+	}
+	catch (const std::exception &e)
+	{
+		_cacheError = e.what();
+		return nullptr;
+	}
+}
+
+void Harness::RunIteration(bool record)
+{
+	std::chrono::nanoseconds total{};
+	++_runs;
+
+	// Inputs that cannot be re-read (pipes) are only loaded once, resident inputs never.
+	if (!_resident && (!_input || _input->IsMapped()))
+	{
+		_input.reset();
+		const auto elapsed = Measure(0, record, [this]
+		{
+			_input = std::make_shared<InputFile>(_options.inputPath);
+		});
+		_inputSize = _input->Contents().size();
+
+		total += elapsed;
+		if (record)
+		{
+			_samples[0].push_back(elapsed);
+		}
+		else if (_options.coldLoad && !_coldLoad.has_value())
+		{
+			_coldLoad = elapsed;
+		}
+	}
+
+	for (auto i = 0U; i < _phases.size(); ++i)
+	{
+		const auto elapsed = Measure(i + 1, record, [this, i]
+		{
+			_phases[i](*_input);
+		});
+
+		total += elapsed;
+		if (record)
+		{
+			_samples[i + 1].push_back(elapsed);
+		}
+	}
+
+	if (record)
+	{
+		_totals.push_back(total);
+	}
+}
+
+void Harness::RunStream()
+{
+	if (!_stream)
+	{
+		throw std::runtime_error("Streaming input is not supported by " + _name);
+	}
+	if (!_streamPhase.has_value())
+	{
+		_streamPhase = _phaseNames.size();
+		_phaseNames.push_back("Stream");
+	}
+
+	_samples.assign(_phaseNames.size(), {});
+	_perf.reset();
+	_perfSamples.assign(_phaseNames.size(), {});
+	_allocationSamples.assign(_phaseNames.size(), {});
+	if (_options.perfCounters)
+	{
+		_perf.emplace();
+	}
+
+	++_runs;
+	ChunkReader reader{_options.inputPath};
+	const auto elapsed = Measure(*_streamPhase, true, [this, &reader]
+	{
+		_streamResults = _stream(reader);
+	});
+	_inputSize = reader.BytesRead();
+	_samples[*_streamPhase].push_back(elapsed);
+	_totals.push_back(elapsed);
+}
+
+template<class Function>
+std::chrono::nanoseconds Harness::Measure(std::size_t index, bool record, Function function)
+{
+	// The counters are read outside of the timed region so the read syscalls do not show up in the wall time.
+	const auto perfBegin = _perf.has_value() ? _perf->Read() : PerfReading{};
+	ResetAllocationPeak();
+	const auto allocationsBegin = ThreadAllocations();
+	const auto begin = Clock::now();
+	function();
+	const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin);
+	const auto allocationsEnd = ThreadAllocations();
+
+	if (record && AllocationTrackingEnabled())
+	{
+		_allocationSamples[index].push_back(AllocationDelta(allocationsBegin, allocationsEnd));
+	}
+
+	if (record && _perf.has_value() && _perf->Available())
+	{
+		_perfSamples[index].push_back(PerfDelta(perfBegin, _perf->Read()));
+	}
+
+	if (_phaseHook)
+	{
+		_phaseHook(_phaseNames[index], elapsed);
+	}
+	return elapsed;
+}
+
+double Harness::Throughput(std::chrono::nanoseconds elapsed) const
+{
+	if (elapsed.count() == 0)
+	{
+		return 0.0;
+	}
+	return static_cast<double>(_inputSize) / (static_cast<double>(elapsed.count()) / 1e9) / 1e6;
+}
+
+void Harness::PrintResults(std::ostream &os) const
+{
+	for (const auto &[name, value]: Results())
+	{
+		if (value.find('\n') != std::string::npos)
+		{
+			os << name << " result: \r\n" << value << "\r\n";
+		}
+		else
+		{
+			os << name << " result: " << value << "\r\n";
+		}
+	}
+}
+
+void Harness::PrintReport(std::ostream &os) const
+{
+	constexpr auto NameWidth = 12;
+	constexpr auto ColumnWidth = 14;
+
+	if (_cachedResults.has_value())
+	{
+		os << "Results from cache, lookup took " << FormatMicroseconds(*_cacheLookup) << "\r\n";
+		return;
+	}
+	if (!_cacheError.empty())
+	{
+		os << "Result cache unavailable: " << _cacheError << "\r\n";
+	}
+
+	os << std::left << std::setw(NameWidth) << "Phase"
+	   << std::right << std::setw(ColumnWidth) << "min"
+	   << std::setw(ColumnWidth) << "median"
+	   << std::setw(ColumnWidth) << "p99" << "\r\n";
+
+	const auto printRow = [&os](const std::string &name, const PhaseStatistics &statistics)
+	{
+		os << std::left << std::setw(NameWidth) << name
+		   << std::right << std::setw(ColumnWidth) << FormatMicroseconds(statistics.min)
+		   << std::setw(ColumnWidth) << FormatMicroseconds(statistics.median)
+		   << std::setw(ColumnWidth) << FormatMicroseconds(statistics.p99) << "\r\n";
+	};
+
+	for (auto i = 0U; i < _phaseNames.size(); ++i)
+	{
+		if (!_samples[i].empty())
+		{
+			printRow(_phaseNames[i], Summarize(_samples[i]));
+		}
+	}
+	printRow("Total", Summarize(_totals));
+	os << std::left;
+
+	if (_streamPhase.has_value() && !_samples[*_streamPhase].empty())
+	{
+		os << std::fixed << std::setprecision(1) << "Stream throughput: "
+		   << Throughput(_samples[*_streamPhase].front()) << " MB/s\r\n" << std::defaultfloat;
+	}
+
+	if (!_samples[0].empty())
+	{
+		os << std::fixed << std::setprecision(1) << "Load throughput: "
+		   << Throughput(Summarize(_samples[0]).median) << " MB/s warm";
+		if (_coldLoad.has_value())
+		{
+			os << ", " << Throughput(*_coldLoad) << " MB/s cold";
+		}
+		os << "\r\n" << std::defaultfloat;
+	}
+
+	if (_perf.has_value())
+	{
+		PrintPerfReport(os);
+	}
+	if constexpr (AllocationTrackingEnabled())
+	{
+		PrintAllocationReport(os);
+	}
+	if ((_perf.has_value() || AllocationTrackingEnabled()) && DefaultPoolSize() > 1)
+	{
+		os << "Counters only cover the calling thread, the solvers ran on " << DefaultPoolSize()
+		   << " pool threads\r\n";
+	}
+}
+
+void Harness::PrintAllocationReport(std::ostream &os) const
+{
+	constexpr auto NameWidth = 12;
+	constexpr auto ColumnWidth = 15;
+
+	os << std::left << std::setw(NameWidth) << "Phase" << std::right
+	   << std::setw(ColumnWidth) << "allocations" << std::setw(ColumnWidth) << "bytes"
+	   << std::setw(ColumnWidth) << "peak live" << std::setw(ColumnWidth) << "retained" << "\r\n";
+	for (auto i = 0U; i < _phaseNames.size(); ++i)
+	{
+		const auto &samples = _allocationSamples[i];
+		if (samples.empty())
+		{
+			continue;
+		}
+
+		os << std::left << std::setw(NameWidth) << _phaseNames[i] << std::right
+		   << std::setw(ColumnWidth) << Median(samples, [](const auto &sample) { return sample.allocations; })
+		   << std::setw(ColumnWidth) << Median(samples, [](const auto &sample) { return sample.bytes; })
+		   << std::setw(ColumnWidth) << Median(samples, [](const auto &sample) { return sample.peakLiveBytes; })
+		   << std::setw(ColumnWidth) << Median(samples, [](const auto &sample) { return sample.liveBytes; }) << "\r\n";
+	}
+	os << std::left;
+}
+
+void Harness::PrintPerfReport(std::ostream &os) const
+{
+	constexpr auto NameWidth = 12;
+	constexpr auto ColumnWidth = 15;
+
+	if (!_perf->Available())
+	{
+		os << "Hardware counters unavailable: " << _perf->Error() << "\r\n";
+		return;
+	}
+
+	os << std::left << std::setw(NameWidth) << "Phase" << std::right << std::setw(ColumnWidth) << "median";
+	for (auto event = 0U; event < PerfEventCount; ++event)
+	{
+		os << std::setw(ColumnWidth) << PerfEventName(static_cast<PerfEvent>(event));
+	}
+	os << std::setw(8) << "IPC" << "\r\n";
+
+	const auto cycles = static_cast<std::size_t>(PerfEvent::Cycles);
+	const auto instructions = static_cast<std::size_t>(PerfEvent::Instructions);
+	for (auto i = 0U; i < _phaseNames.size(); ++i)
+	{
+		const auto &samples = _perfSamples[i];
+		if (samples.empty())
+		{
+			continue;
+		}
+
+		os << std::left << std::setw(NameWidth) << _phaseNames[i]
+		   << std::right << std::setw(ColumnWidth) << FormatMicroseconds(Summarize(_samples[i]).median);
+		for (auto event = 0U; event < PerfEventCount; ++event)
+		{
+			if (_perf->Available(static_cast<PerfEvent>(event)))
+			{
+				os << std::setw(ColumnWidth) << PerfMedian(samples, event);
+			}
+			else
+			{
+				os << std::setw(ColumnWidth) << "n/a";
+			}
+		}
+
+		if (_perf->Available(PerfEvent::Cycles) && _perf->Available(PerfEvent::Instructions))
+		{
+			// Ratio of the sums rather than a median of ratios, short phases would otherwise dominate.
+			double cycleSum = 0.0;
+			double instructionSum = 0.0;
+			for (const auto &sample: samples)
+			{
+				cycleSum += static_cast<double>(sample[cycles]);
+				instructionSum += static_cast<double>(sample[instructions]);
+			}
+			os << std::setw(8) << std::fixed << std::setprecision(2)
+			   << (cycleSum == 0.0 ? 0.0 : instructionSum / cycleSum) << std::defaultfloat;
+		}
+		else
+		{
+			os << std::setw(8) << "n/a";
+		}
+		os << "\r\n";
+	}
+	os << std::left;
+}
+
+void Harness::WriteJson(std::ostream &os) const
+{
+	os << "{\n";
+	os << "  \"name\": \"" << EscapeJson(_name) << "\",\n";
+	os << "  \"input\": \"" << EscapeJson(_options.inputPath) << "\",\n";
+	os << "  \"input_bytes\": " << _inputSize << ",\n";
+	os << "  \"warmup\": " << _options.warmup << ",\n";
+	os << "  \"iterations\": " << _options.iterations << ",\n";
+	os << "  \"stream\": " << (_options.stream ? "true" : "false") << ",\n";
+	// Whole process, so shared by all days when they run inside aoc_all.
+	os << "  \"process_max_rss_kb\": " << PeakRssKilobytes() << ",\n";
+#ifdef NDEBUG
+	os << "  \"debug_build\": false,\n";
+#else
+	os << "  \"debug_build\": true,\n";
+#endif
+
+	os << "  \"results\": {";
+	const auto results = Results();
+	for (auto i = 0U; i < results.size(); ++i)
+	{
+		os << (i == 0 ? "" : ", ") << "\"" << EscapeJson(results[i].first) << "\": \""
+		   << EscapeJson(results[i].second) << "\"";
+	}
+	os << "},\n";
+
+	const auto *cacheState = _cachedResults.has_value() ? "hit" : _cacheLookup.has_value() ? "miss" : "off";
+	os << "  \"cache\": \"" << cacheState << "\",\n";
+	if (_cacheLookup.has_value())
+	{
+		os << "  \"cache_lookup_ns\": " << _cacheLookup->count() << ",\n";
+	}
+	if (!_cacheError.empty())
+	{
+		os << "  \"cache_error\": \"" << EscapeJson(_cacheError) << "\",\n";
+	}
+
+	if (_coldLoad.has_value())
+	{
+		os << "  \"cold_load_ns\": " << _coldLoad->count() << ",\n";
+	}
+
+	if (_perf.has_value() && !_perf->Available())
+	{
+		os << "  \"perf_error\": \"" << EscapeJson(_perf->Error()) << "\",\n";
+	}
+	if ((_perf.has_value() || AllocationTrackingEnabled()) && DefaultPoolSize() > 1)
+	{
+		os << "  \"counters_calling_thread_only\": true,\n";
+	}
+
+	if constexpr (instrumentation::Enabled())
+	{
+		os << "  \"instrumentation\": ";
+		instrumentation::WriteJson(os, _name + ".");
+		os << ",\n";
+	}
+
+	os << "  \"phases\": [\n";
+	for (auto i = 0U; i < _phaseNames.size(); ++i)
+	{
+		if (_samples[i].empty())
+		{
+			continue;
+		}
+		os << "    {\"name\": \"" << EscapeJson(_phaseNames[i]) << "\", ";
+		WriteStatistics(os, Summarize(_samples[i]));
+		if (!_perfSamples[i].empty())
+		{
+			os << ", \"perf\": {";
+			auto first = true;
+			for (auto event = 0U; event < PerfEventCount; ++event)
+			{
+				if (_perf->Available(static_cast<PerfEvent>(event)))
+				{
+					os << (first ? "" : ", ") << "\"" << PerfEventName(static_cast<PerfEvent>(event)) << "\": "
+					   << PerfMedian(_perfSamples[i], event);
+					first = false;
+				}
+			}
+			os << "}";
+		}
+		if (!_allocationSamples[i].empty())
+		{
+			const auto &samples = _allocationSamples[i];
+			os << ", \"allocations\": {\"count\": " << Median(samples, [](const auto &sample) { return sample.allocations; })
+			   << ", \"bytes\": " << Median(samples, [](const auto &sample) { return sample.bytes; })
+			   << ", \"peak_live_bytes\": " << Median(samples, [](const auto &sample) { return sample.peakLiveBytes; })
+			   << ", \"retained_bytes\": " << Median(samples, [](const auto &sample) { return sample.liveBytes; }) << "}";
+		}
+		os << ", \"samples_ns\": [";
+		for (auto j = 0U; j < _samples[i].size(); ++j)
+		{
+			os << (j == 0 ? "" : ", ") << _samples[i][j].count();
+		}
+		os << "]},\n";
+	}
+	os << "    {\"name\": \"Total\", ";
+	WriteStatistics(os, Summarize(_totals));
+	os << ", \"samples_ns\": [";
+	for (auto j = 0U; j < _totals.size(); ++j)
+	{
+		os << (j == 0 ? "" : ", ") << _totals[j].count();
+	}
+	os << "]}\n";
+	os << "  ]\n";
+	os << "}\n";
+}
+
+const std::string &Harness::Name() const
+{
+	return _name;
+}
+
+const HarnessOptions &Harness::Options() const
+{
+	return _options;
+}
+
+std::size_t Harness::Runs() const
+{
+	return _runs;
+}
+
+ResultValues Harness::Results() const
+{
+	if (_cachedResults.has_value())
+	{
+		return *_cachedResults;
+	}
+	if (_streamResults.has_value())
+	{
+		return *_streamResults;
+	}
+
+	ResultValues results;
+	for (const auto &[name, result]: _results)
+	{
+		results.emplace_back(name, result());
+	}
+	return results;
+}
+
+void Harness::SetSolverVersion(std::string version)
+{
+	_solverVersion = std::move(version);
+}
+
+void Harness::SetStream(Harness::Stream stream)
+{
+	_stream = std::move(stream);
+}
+
+void Harness::SetPhaseHook(Harness::PhaseHook hook)
+{
+	_phaseHook = std::move(hook);
+}
+
+void Harness::UseInput(std::shared_ptr<const InputFile> input)
+{
+	_input = std::move(input);
+	_inputSize = _input->Contents().size();
+	_resident = true;
+}
+
+void Harness::SetPersistentState(std::shared_ptr<PersistentState> state)
+{
+	_persistent = std::move(state);
+}
+
+PersistentState *Harness::Persistent() const
+{
+	return _persistent.get();
+}
+
+int RunHarness(const std::string &name, int argc, char **argv, const std::function<void(Harness &)> &registration)
+{
+	auto options = ParseHarnessOptions(argc, argv);
+	if (options.batch)
+	{
+		return RunBatch(name, options, registration);
+	}
+
+	Harness harness{name, std::move(options)};
+	SetDefaultPoolSize(harness.Options().threads);
+	registration(harness);
+	harness.Run();
+
+	harness.PrintResults(std::cout);
+	harness.PrintReport(std::cout);
+
+	if constexpr (instrumentation::Enabled())
+	{
+		std::cout << "Instrumentation, totals over " << harness.Runs() << " runs:\r\n";
+		instrumentation::WriteReport(std::cout, name + ".");
+	}
+
+	if (const auto &jsonPath = harness.Options().jsonPath; jsonPath.has_value())
+	{
+		std::ofstream file(*jsonPath);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		harness.WriteJson(file);
+	}
+
+	return 0;
+}
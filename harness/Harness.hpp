@@ -0,0 +1,256 @@
+#ifndef ADVENTOFCODE2021_HARNESS_HPP
+#define ADVENTOFCODE2021_HARNESS_HPP
+
+#include "ChunkReader.hpp"
+#include "InputFile.hpp"
+#include "PerfCounters.hpp"
+#include "AllocationTracker.hpp"
+#include "ResultCache.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+struct HarnessOptions
+{
+	std::string inputPath;
+	std::size_t warmup = 0;
+	std::size_t iterations = 1;
+	bool coldLoad = false;
+	bool perfCounters = false;
+	std::optional<std::string> jsonPath;
+	bool resultCache = false;
+	std::optional<std::string> cacheDirectory;
+	// Solve with the day's streaming fold instead of loading the whole input, see Harness::SetStream.
+	bool stream = false;
+	// Workers of the default pool used inside the solvers, zero keeps $AOC_THREADS or the hardware count.
+	std::size_t threads = 0;
+	// Solve every input of batchInputs and the manifest in one process, see RunBatch.
+	bool batch = false;
+	std::vector<std::string> batchInputs;
+	std::optional<std::string> manifestPath;
+	// Inputs solved at once in batch mode, zero selects the hardware count.
+	std::size_t jobs = 0;
+};
+
+// Accepts: [--warmup N] [--iterations N] [--cold] [--perf] [--json PATH] [--cache] [--no-cache] [--cache-dir PATH]
+//          [--threads N] [--stream] INPUT
+//          [--batch] [--manifest PATH] [--jobs N] [--threads N] [--json PATH] INPUT...
+// INPUT "-" reads stdin. --stream runs once and never uses the result cache, stdin cannot be read twice.
+// --manifest implies --batch, in batch mode every INPUT is a file or a directory of inputs.
+// --perf and allocation tracking (AOC_ALLOCATION_TRACKING) force --threads 1, their counters only follow
+// the calling thread.
+// The result cache is opt-in with --cache and only used for plain runs, anything that measures (warmup,
+// iterations, cold, perf) always executes the solvers. Results that were faster to solve than to look up
+// are not stored.
+[[nodiscard]] HarnessOptions ParseHarnessOptions(int argc, char **argv);
+
+struct PhaseStatistics
+{
+	std::chrono::nanoseconds min;
+	std::chrono::nanoseconds median;
+	std::chrono::nanoseconds p99;
+	std::chrono::nanoseconds mean;
+};
+
+[[nodiscard]] PhaseStatistics Summarize(std::vector<std::chrono::nanoseconds> samples);
+
+[[nodiscard]] std::string EscapeJson(std::string_view str);
+
+// Keyed store for solver state that outlives a single run, e.g. memo tables that only depend on the
+// puzzle rules and not on the input. Get creates the entry on first use.
+class PersistentState
+{
+public:
+	template<class T>
+	std::shared_ptr<T> Get(const std::string &key)
+	{
+		std::lock_guard lock(_mutex);
+		auto &entry = _entries[key];
+		if (!entry)
+		{
+			entry = std::make_shared<T>();
+		}
+		return std::static_pointer_cast<T>(entry);
+	}
+
+private:
+	std::mutex _mutex;
+	std::unordered_map<std::string, std::shared_ptr<void>> _entries;
+};
+
+// Memo table guarded by a mutex, the shape solvers keep in a PersistentState.
+template<class Table>
+struct SharedMemo
+{
+	std::mutex mutex;
+	Table table;
+};
+
+// Runs the registered phases of one day in order, warmup + N times, and records a wall clock sample
+// per phase. The input file is reloaded on every iteration as the implicit "Load" phase.
+class Harness
+{
+public:
+	using Phase = std::function<void(const InputFile &input)>;
+	using Result = std::function<std::string()>;
+	using Stream = std::function<ResultValues(ChunkReader &reader)>;
+	using PhaseHook = std::function<void(const std::string &phase, std::chrono::nanoseconds elapsed)>;
+
+	Harness(std::string name, HarnessOptions options);
+
+	void AddPhase(std::string name, Phase phase);
+	void AddResult(std::string name, Result result);
+
+	void Run();
+
+	void PrintResults(std::ostream &os) const;
+	void PrintReport(std::ostream &os) const;
+	void WriteJson(std::ostream &os) const;
+
+	[[nodiscard]] const std::string &Name() const;
+	[[nodiscard]] const HarnessOptions &Options() const;
+	// Number of iterations executed so far, including warmup.
+	[[nodiscard]] std::size_t Runs() const;
+	// Result values, either from the result cache or from the registered result functions.
+	[[nodiscard]] ResultValues Results() const;
+
+	// Identifies the solver code in result cache keys, results are only cached when it is set.
+	void SetSolverVersion(std::string version);
+
+	// Solver for HarnessOptions::stream runs. It folds the input chunk by chunk while the next chunk is
+	// read and returns the results itself, the registered phases and results are not used.
+	void SetStream(Stream stream);
+
+	// Runs the phases on an input that is already loaded instead of loading Options().inputPath, the
+	// "Load" phase is skipped.
+	void UseInput(std::shared_ptr<const InputFile> input);
+
+	// Called after every phase that ran, warmup iterations included, outside of the measured time. Lets
+	// hosts that embed the solvers feed their own metrics.
+	void SetPhaseHook(PhaseHook hook);
+
+	// State shared with later harnesses, set by long running hosts such as aoc_server. Null otherwise,
+	// in which case solvers must not keep anything between runs.
+	void SetPersistentState(std::shared_ptr<PersistentState> state);
+	[[nodiscard]] PersistentState *Persistent() const;
+
+private:
+	void RunIteration(bool record);
+	void RunStream();
+	[[nodiscard]] std::unique_ptr<ResultCache> LookupResults(CacheKey &key);
+	void PrintPerfReport(std::ostream &os) const;
+	void PrintAllocationReport(std::ostream &os) const;
+	template<class Function>
+	std::chrono::nanoseconds Measure(std::size_t index, bool record, Function function);
+	[[nodiscard]] double Throughput(std::chrono::nanoseconds elapsed) const;
+
+private:
+	std::string _name;
+	HarnessOptions _options;
+	std::vector<std::string> _phaseNames;
+	std::vector<Phase> _phases;
+	std::vector<std::pair<std::string, Result>> _results;
+	Stream _stream;
+	std::optional<std::size_t> _streamPhase;
+	std::optional<ResultValues> _streamResults;
+	PhaseHook _phaseHook;
+
+	std::shared_ptr<const InputFile> _input;
+	std::size_t _inputSize = 0;
+	bool _resident = false;
+	std::shared_ptr<PersistentState> _persistent;
+	std::string _solverVersion;
+	std::optional<ResultValues> _cachedResults;
+	std::optional<std::chrono::nanoseconds> _cacheLookup;
+	std::string _cacheError;
+	std::optional<std::chrono::nanoseconds> _coldLoad;
+	std::size_t _runs = 0;
+	std::vector<std::vector<std::chrono::nanoseconds>> _samples;
+	std::vector<std::chrono::nanoseconds> _totals;
+
+	std::optional<PerfCounters> _perf;
+	std::vector<std::vector<std::array<std::uint64_t, PerfEventCount>>> _perfSamples;
+	// Per phase deltas, peakLiveBytes is the peak above the live bytes at the start of the phase.
+	std::vector<std::vector<AllocationStatistics>> _allocationSamples;
+};
+
+template<class T>
+std::string ResultToString(const T &value)
+{
+	std::ostringstream stream;
+	stream << value;
+	return stream.str();
+}
+
+// Registers the common "Parse", "Part 1", "Part 2" shape: parse(InputFile) produces the input
+// that both part functions receive by const reference.
+template<class ParseFunction, class Part1Function, class Part2Function>
+void RegisterSolution(Harness &harness, ParseFunction parse, Part1Function part1, Part2Function part2)
+{
+	using Input = std::invoke_result_t<ParseFunction, const InputFile &>;
+	using Part1 = std::decay_t<std::invoke_result_t<Part1Function, const Input &>>;
+	using Part2 = std::decay_t<std::invoke_result_t<Part2Function, const Input &>>;
+
+	struct State
+	{
+		std::optional<Input> input;
+		std::optional<Part1> part1;
+		std::optional<Part2> part2;
+	};
+	auto state = std::make_shared<State>();
+
+	harness.AddPhase("Parse", [state, parse](const InputFile &file)
+	{
+		state->input.reset();
+		state->input.emplace(parse(file));
+	});
+	harness.AddPhase("Part 1", [state, part1](const InputFile &)
+	{
+		state->part1.emplace(part1(*state->input));
+	});
+	harness.AddPhase("Part 2", [state, part2](const InputFile &)
+	{
+		state->part2.emplace(part2(*state->input));
+	});
+	harness.AddResult("Part 1", [state]
+	{
+		return ResultToString(*state->part1);
+	});
+	harness.AddResult("Part 2", [state]
+	{
+		return ResultToString(*state->part2);
+	});
+}
+
+// Registers a line fold for --stream runs. Fold is default constructible and provides Consume(line),
+// Part1() and Part2(), so it holds only the state it needs and never the input.
+template<class Fold>
+void RegisterStreamingFold(Harness &harness)
+{
+	harness.SetStream([](ChunkReader &reader)
+	{
+		Fold fold{};
+		ForEachLine(reader, [&fold](std::string_view line)
+		{
+			fold.Consume(line);
+		});
+		return ResultValues{{"Part 1", ResultToString(fold.Part1())}, {"Part 2", ResultToString(fold.Part2())}};
+	});
+}
+
+// Entry point shared by every dayN main: parses the command line, runs the harness and prints the report.
+// --batch command lines go to RunBatch.
+int RunHarness(const std::string &name, int argc, char **argv, const std::function<void(Harness &)> &registration);
+
+#endif //ADVENTOFCODE2021_HARNESS_HPP
@@ -0,0 +1,154 @@
+#include "PerfCounters.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+std::string_view PerfEventName(PerfEvent event)
+{
+	switch (event)
+	{
+		case PerfEvent::Cycles:
+			return "cycles";
+		case PerfEvent::Instructions:
+			return "instructions";
+		case PerfEvent::CacheMisses:
+			return "cache-misses";
+		case PerfEvent::BranchMisses:
+			return "branch-misses";
+	}
+	return "unknown";
+}
+
+std::array<std::uint64_t, PerfEventCount> PerfDelta(const PerfReading &begin, const PerfReading &end)
+{
+	std::array<std::uint64_t, PerfEventCount> result{};
+	const auto enabled = end.timeEnabled - begin.timeEnabled;
+	const auto running = end.timeRunning - begin.timeRunning;
+	for (auto i = 0U; i < PerfEventCount; ++i)
+	{
+		const auto delta = end.values[i] - begin.values[i];
+		result[i] = running == 0 || running == enabled
+				? delta
+				: static_cast<std::uint64_t>(static_cast<double>(delta) * static_cast<double>(enabled) / static_cast<double>(running));
+	}
+	return result;
+}
+
+#ifdef __linux__
+
+PerfCounters::PerfCounters()
+{
+	constexpr std::array<std::uint64_t, PerfEventCount> Configs{
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_CACHE_MISSES,
+			PERF_COUNT_HW_BRANCH_MISSES,
+	};
+
+	_descriptors.fill(-1);
+	_slots.fill(-1);
+	for (auto i = 0U; i < PerfEventCount; ++i)
+	{
+		perf_event_attr attr{};
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = Configs[i];
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, _leader, 0));
+		if (fd < 0)
+		{
+			if (_error.empty())
+			{
+				_error = std::string{"perf_event_open failed: "} + std::strerror(errno);
+			}
+			continue;
+		}
+
+		if (_leader < 0)
+		{
+			_leader = fd;
+		}
+		_descriptors[i] = fd;
+		_slots[i] = static_cast<int>(_opened++);
+	}
+}
+
+PerfCounters::~PerfCounters()
+{
+	for (const auto fd: _descriptors)
+	{
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+	}
+}
+
+PerfReading PerfCounters::Read() const
+{
+	PerfReading reading{};
+	if (_leader < 0)
+	{
+		return reading;
+	}
+
+	// Layout of a PERF_FORMAT_GROUP read: nr, time_enabled, time_running, value[nr]
+	std::array<std::uint64_t, 3 + PerfEventCount> buffer{};
+	if (read(_leader, buffer.data(), sizeof(buffer)) < static_cast<ssize_t>((3 + _opened) * sizeof(std::uint64_t)))
+	{
+		return reading;
+	}
+
+	reading.timeEnabled = buffer[1];
+	reading.timeRunning = buffer[2];
+	for (auto i = 0U; i < PerfEventCount; ++i)
+	{
+		if (_slots[i] >= 0)
+		{
+			reading.values[i] = buffer[3 + static_cast<std::size_t>(_slots[i])];
+		}
+	}
+	return reading;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+		: _error("perf_event_open is only available on Linux")
+{
+	_descriptors.fill(-1);
+	_slots.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+PerfReading PerfCounters::Read() const
+{
+	return {};
+}
+
+#endif
+
+bool PerfCounters::Available() const
+{
+	return _opened > 0;
+}
+
+bool PerfCounters::Available(PerfEvent event) const
+{
+	return _slots[static_cast<std::size_t>(event)] >= 0;
+}
+
+const std::string &PerfCounters::Error() const
+{
+	return _error;
+}
@@ -0,0 +1,59 @@
+#ifndef ADVENTOFCODE2021_PERFCOUNTERS_HPP
+#define ADVENTOFCODE2021_PERFCOUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+enum class PerfEvent
+{
+	Cycles,
+	Instructions,
+	CacheMisses,
+	BranchMisses,
+};
+
+constexpr std::size_t PerfEventCount = 4;
+
+[[nodiscard]] std::string_view PerfEventName(PerfEvent event);
+
+struct PerfReading
+{
+	std::array<std::uint64_t, PerfEventCount> values{};
+	std::uint64_t timeEnabled = 0;
+	std::uint64_t timeRunning = 0;
+};
+
+// Counts between two readings, scaled up when the kernel had to multiplex the group.
+[[nodiscard]] std::array<std::uint64_t, PerfEventCount> PerfDelta(const PerfReading &begin, const PerfReading &end);
+
+// Hardware counters of the calling thread (user space only) opened as one perf_event_open group, so all
+// events are scheduled together. Events the CPU or kernel does not offer are left out, and when none can
+// be opened Available() is false and Error() tells why. Only counts the thread that created the object.
+class PerfCounters
+{
+public:
+	PerfCounters();
+	~PerfCounters();
+
+	PerfCounters(const PerfCounters &) = delete;
+	PerfCounters &operator=(const PerfCounters &) = delete;
+
+	[[nodiscard]] bool Available() const;
+	[[nodiscard]] bool Available(PerfEvent event) const;
+	[[nodiscard]] const std::string &Error() const;
+
+	[[nodiscard]] PerfReading Read() const;
+
+private:
+	int _leader = -1;
+	std::array<int, PerfEventCount> _descriptors{};
+	// Position of each event in the group read, or -1 when the event could not be opened.
+	std::array<int, PerfEventCount> _slots{};
+	std::size_t _opened = 0;
+	std::string _error;
+};
+
+#endif //ADVENTOFCODE2021_PERFCOUNTERS_HPP
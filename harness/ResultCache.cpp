@@ -0,0 +1,290 @@
+#include "ResultCache.hpp"
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+	constexpr std::uint64_t IndexMagic = 0x31656863436f6361ULL;
+	constexpr std::string_view EntryMagic = "aoc-result-cache 1\n";
+	constexpr std::size_t ProbeLength = 8;
+
+	class IndexLock
+	{
+	public:
+		explicit IndexLock(int fd) : _fd(fd)
+		{
+			if (::flock(_fd, LOCK_EX) != 0)
+			{
+				throw std::runtime_error("Failed to lock result cache");
+			}
+		}
+
+		~IndexLock()
+		{
+			::flock(_fd, LOCK_UN);
+		}
+
+		IndexLock(const IndexLock &) = delete;
+		IndexLock &operator=(const IndexLock &) = delete;
+
+	private:
+		int _fd;
+	};
+
+	std::string SerializeKey(const CacheKey &key)
+	{
+		std::ostringstream stream;
+		stream << key.day << '\n' << key.solverVersion << '\n' << std::hex << key.inputHash << std::dec << '\n'
+		       << key.inputSize << '\n';
+		return stream.str();
+	}
+
+	std::uint64_t SlotKey(const CacheKey &key)
+	{
+		// Zero marks an empty slot.
+		return std::max<std::uint64_t>(HashBytes(SerializeKey(key)), 1);
+	}
+
+	std::optional<ResultValues> ReadEntry(const std::filesystem::path &path, const CacheKey &key)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+		{
+			return std::nullopt;
+		}
+		const std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+		// The whole key is stored in the entry so slot key collisions are detected here.
+		const auto header = std::string{EntryMagic} + SerializeKey(key);
+		if (!contents.starts_with(header))
+		{
+			return std::nullopt;
+		}
+
+		std::istringstream stream{contents.substr(header.size())};
+		std::size_t count = 0;
+		stream >> count;
+		ResultValues results;
+		for (auto i = 0U; i < count; ++i)
+		{
+			std::string name;
+			std::size_t length = 0;
+			stream.ignore(1);
+			std::getline(stream, name);
+			stream >> length;
+			stream.ignore(1);
+			std::string value(length, '\0');
+			stream.read(value.data(), static_cast<std::streamsize>(length));
+			if (!stream.good())
+			{
+				return std::nullopt;
+			}
+			results.emplace_back(std::move(name), std::move(value));
+		}
+		return results;
+	}
+
+	void WriteEntry(const std::filesystem::path &path, const CacheKey &key, const ResultValues &results)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file << EntryMagic << SerializeKey(key) << results.size();
+		for (const auto &[name, value]: results)
+		{
+			file << '\n' << name << '\n' << value.size() << '\n' << value;
+		}
+		file << '\n';
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to write result cache entry");
+		}
+	}
+}
+
+struct ResultCache::Header
+{
+	std::uint64_t magic;
+	std::uint64_t capacity;
+	// Logical clock for the least recently used eviction.
+	std::uint64_t clock;
+};
+
+struct ResultCache::Slot
+{
+	std::uint64_t key;
+	std::uint64_t lastUsed;
+};
+
+ResultCache::ResultCache(std::filesystem::path directory, std::size_t capacity)
+		: _directory(std::move(directory)), _capacity(std::max<std::size_t>(capacity, ProbeLength))
+{
+	std::filesystem::create_directories(_directory / "entries");
+
+	_fd = ::open((_directory / "index").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+	if (_fd < 0)
+	{
+		throw std::runtime_error("Failed to open result cache");
+	}
+
+	IndexLock lock{_fd};
+	Header header{};
+	struct stat info{};
+	const auto valid = ::fstat(_fd, &info) == 0 &&
+	                   ::pread(_fd, &header, sizeof(header), 0) == sizeof(header) &&
+	                   header.magic == IndexMagic && header.capacity >= ProbeLength &&
+	                   static_cast<std::size_t>(info.st_size) == sizeof(Header) + header.capacity * sizeof(Slot);
+	if (valid)
+	{
+		_capacity = header.capacity;
+	}
+	else
+	{
+		// Missing or from an incompatible version: start over with an empty index.
+		header = {IndexMagic, _capacity, 0};
+		if (::ftruncate(_fd, 0) != 0 ||
+		    ::ftruncate(_fd, static_cast<off_t>(sizeof(Header) + _capacity * sizeof(Slot))) != 0 ||
+		    ::pwrite(_fd, &header, sizeof(header), 0) != sizeof(header))
+		{
+			::close(_fd);
+			throw std::runtime_error("Failed to initialize result cache");
+		}
+	}
+
+	_mappingSize = sizeof(Header) + _capacity * sizeof(Slot);
+	_mapping = ::mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+	if (_mapping == MAP_FAILED)
+	{
+		::close(_fd);
+		throw std::runtime_error("Failed to map result cache");
+	}
+}
+
+ResultCache::~ResultCache()
+{
+	::munmap(_mapping, _mappingSize);
+	::close(_fd);
+}
+
+std::optional<ResultValues> ResultCache::Find(const CacheKey &key)
+{
+	const auto slotKey = SlotKey(key);
+	const auto first = slotKey % _capacity;
+
+	IndexLock lock{_fd};
+	auto *slots = Slots();
+	for (auto i = 0U; i < ProbeLength; ++i)
+	{
+		auto &slot = slots[(first + i) % _capacity];
+		if (slot.key != slotKey)
+		{
+			continue;
+		}
+
+		auto results = ReadEntry(EntryPath(slotKey), key);
+		if (!results.has_value())
+		{
+			std::error_code error;
+			std::filesystem::remove(EntryPath(slotKey), error);
+			slot = {};
+			return std::nullopt;
+		}
+		slot.lastUsed = ++static_cast<Header *>(_mapping)->clock;
+		return results;
+	}
+	return std::nullopt;
+}
+
+void ResultCache::Store(const CacheKey &key, const ResultValues &results)
+{
+	const auto slotKey = SlotKey(key);
+	const auto first = slotKey % _capacity;
+
+	// Written next to the final path and renamed so readers never see a partial entry.
+	std::ostringstream suffix;
+	suffix << '.' << ::getpid() << '.' << std::hash<std::thread::id>{}(std::this_thread::get_id());
+	auto temporary = EntryPath(slotKey);
+	temporary += suffix.str();
+	try
+	{
+		WriteEntry(temporary, key, results);
+	}
+	catch (...)
+	{
+		std::error_code error;
+		std::filesystem::remove(temporary, error);
+		throw;
+	}
+
+	IndexLock lock{_fd};
+	auto *slots = Slots();
+	Slot *target = nullptr;
+	for (auto i = 0U; i < ProbeLength; ++i)
+	{
+		auto &slot = slots[(first + i) % _capacity];
+		if (slot.key == slotKey)
+		{
+			target = &slot;
+			break;
+		}
+		if (target == nullptr || slot.lastUsed < target->lastUsed)
+		{
+			target = &slot;
+		}
+	}
+
+	if (target->key != 0 && target->key != slotKey)
+	{
+		std::error_code error;
+		std::filesystem::remove(EntryPath(target->key), error);
+	}
+	std::error_code error;
+	std::filesystem::rename(temporary, EntryPath(slotKey), error);
+	if (error)
+	{
+		std::filesystem::remove(temporary, error);
+		throw std::runtime_error("Failed to store result cache entry");
+	}
+	*target = {slotKey, ++static_cast<Header *>(_mapping)->clock};
+}
+
+std::filesystem::path ResultCache::DefaultDirectory()
+{
+	if (const auto *directory = std::getenv("AOC_CACHE_DIR"); directory != nullptr && *directory != '\0')
+	{
+		return directory;
+	}
+	if (const auto *cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome != nullptr && *cacheHome != '\0')
+	{
+		return std::filesystem::path{cacheHome} / "aoc2021";
+	}
+	if (const auto *home = std::getenv("HOME"); home != nullptr && *home != '\0')
+	{
+		return std::filesystem::path{home} / ".cache" / "aoc2021";
+	}
+	return std::filesystem::temp_directory_path() / "aoc2021-cache";
+}
+
+std::filesystem::path ResultCache::EntryPath(std::uint64_t slotKey) const
+{
+	std::ostringstream name;
+	name << std::hex << std::setw(16) << std::setfill('0') << slotKey;
+	return _directory / "entries" / name.str();
+}
+
+ResultCache::Slot *ResultCache::Slots() const
+{
+	return reinterpret_cast<Slot *>(static_cast<char *>(_mapping) + sizeof(Header));
+}
@@ -0,0 +1,58 @@
+#ifndef ADVENTOFCODE2021_RESULTCACHE_HPP
+#define ADVENTOFCODE2021_RESULTCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using ResultValues = std::vector<std::pair<std::string, std::string>>;
+
+struct CacheKey
+{
+	std::string day;
+	std::string solverVersion;
+	std::uint64_t inputHash = 0;
+	std::uint64_t inputSize = 0;
+};
+
+// On-disk cache of solver results addressed by (day, solver version, input hash). The directory holds a
+// memory mapped index of fixed slots and one file per entry. A key may only live in a short probe window
+// of slots, when the window is full the least recently used entry is evicted. Processes sharing the
+// directory serialize on an flock of the index.
+class ResultCache
+{
+public:
+	static constexpr std::size_t DefaultCapacity = 4096;
+
+	explicit ResultCache(std::filesystem::path directory, std::size_t capacity = DefaultCapacity);
+	~ResultCache();
+
+	ResultCache(const ResultCache &) = delete;
+	ResultCache &operator=(const ResultCache &) = delete;
+
+	[[nodiscard]] std::optional<ResultValues> Find(const CacheKey &key);
+	void Store(const CacheKey &key, const ResultValues &results);
+
+	// $AOC_CACHE_DIR, otherwise $XDG_CACHE_HOME/aoc2021 or ~/.cache/aoc2021.
+	[[nodiscard]] static std::filesystem::path DefaultDirectory();
+
+private:
+	struct Header;
+	struct Slot;
+
+	[[nodiscard]] std::filesystem::path EntryPath(std::uint64_t slotKey) const;
+	[[nodiscard]] Slot *Slots() const;
+
+private:
+	std::filesystem::path _directory;
+	int _fd = -1;
+	void *_mapping = nullptr;
+	std::size_t _mappingSize = 0;
+	std::size_t _capacity = 0;
+};
+
+#endif //ADVENTOFCODE2021_RESULTCACHE_HPP
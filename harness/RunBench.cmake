@@ -0,0 +1,31 @@
+# Runs every dayN binary through the harness and merges the per-day JSON reports into bench.json.
+# Expects BIN_DIR, INPUT_DIR, OUTPUT_DIR, DAYS, WARMUP and ITERATIONS to be defined.
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(MERGED "")
+foreach (index RANGE 1 ${DAYS})
+    set(INPUT "${INPUT_DIR}/day${index}.txt")
+    if (NOT EXISTS ${INPUT})
+        message(STATUS "day${index}: no input at ${INPUT}, skipping")
+        continue()
+    endif()
+
+    set(REPORT "${OUTPUT_DIR}/day${index}.json")
+    message(STATUS "day${index}")
+    execute_process(
+            COMMAND ${BIN_DIR}/day${index} --cold --warmup ${WARMUP} --iterations ${ITERATIONS} --json ${REPORT} ${INPUT}
+            RESULT_VARIABLE RESULT)
+    if (NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "day${index} failed: ${RESULT}")
+    endif()
+
+    file(READ ${REPORT} CONTENT)
+    if (NOT MERGED STREQUAL "")
+        string(APPEND MERGED ",")
+    endif()
+    string(APPEND MERGED "${CONTENT}")
+endforeach()
+
+file(WRITE "${OUTPUT_DIR}/bench.json" "[${MERGED}]\n")
+message(STATUS "Benchmark report written to ${OUTPUT_DIR}/bench.json")
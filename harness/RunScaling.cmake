@@ -0,0 +1,61 @@
+# Generates inputs of growing size with aoc_gen, runs the matching dayN binary on each of them and merges
+# the reports into scaling.json, one entry per day and scale with the generated size, and either the report,
+# timed_out, failed with the exit status, or skipped when the generator's size range stops the input from growing.
+# Expects GENERATOR, BIN_DIR, OUTPUT_DIR, DAYS (list), SCALES (list), SEED, ITERATIONS and TIMEOUT to be defined.
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(MERGED "")
+foreach (index IN LISTS DAYS)
+    set(PREVIOUS_SIZE "")
+    foreach (scale IN LISTS SCALES)
+        set(INPUT "${OUTPUT_DIR}/day${index}_x${scale}.txt")
+        set(REPORT "${OUTPUT_DIR}/day${index}_x${scale}.json")
+
+        execute_process(
+                COMMAND ${GENERATOR} --scale ${scale} --seed ${SEED} --output ${INPUT} ${index}
+                ERROR_VARIABLE DESCRIPTION
+                RESULT_VARIABLE RESULT)
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "Generating day${index} x${scale} failed: ${RESULT}")
+        endif()
+        string(REGEX MATCH "^day[0-9]+: ([0-9]+)" DESCRIPTION "${DESCRIPTION}")
+        set(SIZE ${CMAKE_MATCH_1})
+
+        if (NOT MERGED STREQUAL "")
+            string(APPEND MERGED ",\n")
+        endif()
+        string(APPEND MERGED "{\"day\": ${index}, \"scale\": ${scale}, \"size\": ${SIZE}, ")
+        if (SIZE STREQUAL PREVIOUS_SIZE)
+            # Clamped to the generator's maximum, larger scales would measure the same input again.
+            message(STATUS "day${index} x${scale}: size ${SIZE} does not grow, skipping larger scales")
+            string(APPEND MERGED "\"skipped\": \"fixed size\"}")
+            break()
+        endif()
+        set(PREVIOUS_SIZE ${SIZE})
+
+        message(STATUS "day${index} x${scale}: size ${SIZE}")
+        execute_process(
+                COMMAND ${BIN_DIR}/day${index} --iterations ${ITERATIONS} --json ${REPORT} ${INPUT}
+                OUTPUT_QUIET
+                TIMEOUT ${TIMEOUT}
+                RESULT_VARIABLE RESULT)
+
+        if (RESULT EQUAL 0)
+            file(READ ${REPORT} CONTENT)
+            string(APPEND MERGED "\"report\": ${CONTENT}}")
+        elseif (RESULT MATCHES "timeout")
+            # Larger scales of this day will not finish either.
+            message(STATUS "day${index} x${scale}: timed out, skipping larger scales")
+            string(APPEND MERGED "\"timed_out\": true}")
+            break()
+        else()
+            message(WARNING "day${index} x${scale} failed: ${RESULT}")
+            string(REPLACE "\"" "\\\"" RESULT "${RESULT}")
+            string(APPEND MERGED "\"failed\": \"${RESULT}\"}")
+        endif()
+    endforeach()
+endforeach()
+
+file(WRITE "${OUTPUT_DIR}/scaling.json" "[${MERGED}]\n")
+message(STATUS "Scaling report written to ${OUTPUT_DIR}/scaling.json")
@@ -0,0 +1,46 @@
+# Runs the days that parallelize internally with a growing worker count and merges the reports into
+# threads.json, one entry per day and thread count with the speedup of the total time over one thread.
+# Expects BIN_DIR, INPUT_DIR, OUTPUT_DIR, DAYS (list), THREADS (list), WARMUP and ITERATIONS to be defined.
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(MERGED "")
+foreach (index IN LISTS DAYS)
+    set(INPUT "${INPUT_DIR}/day${index}.txt")
+    if (NOT EXISTS ${INPUT})
+        message(STATUS "day${index}: no input at ${INPUT}, skipping")
+        continue()
+    endif()
+
+    set(BASELINE "")
+    foreach (threads IN LISTS THREADS)
+        set(REPORT "${OUTPUT_DIR}/day${index}_t${threads}.json")
+        execute_process(
+                COMMAND ${BIN_DIR}/day${index} --no-cache --threads ${threads} --warmup ${WARMUP} --iterations ${ITERATIONS}
+                        --json ${REPORT} ${INPUT}
+                OUTPUT_QUIET
+                RESULT_VARIABLE RESULT)
+        if (NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "day${index} with ${threads} threads failed: ${RESULT}")
+        endif()
+
+        file(READ ${REPORT} CONTENT)
+        # The last phase is the total over all phases.
+        string(JSON PHASES LENGTH "${CONTENT}" phases)
+        math(EXPR LAST "${PHASES} - 1")
+        string(JSON TOTAL GET "${CONTENT}" phases ${LAST} median_ns)
+        if (BASELINE STREQUAL "")
+            set(BASELINE ${TOTAL})
+        endif()
+        math(EXPR SPEEDUP "100 * ${BASELINE} / ${TOTAL}")
+        message(STATUS "day${index} ${threads} threads: ${TOTAL} ns, ${SPEEDUP}% of single thread speed")
+
+        if (NOT MERGED STREQUAL "")
+            string(APPEND MERGED ",\n")
+        endif()
+        string(APPEND MERGED "{\"day\": ${index}, \"threads\": ${threads}, \"speedup_percent\": ${SPEEDUP}, \"report\": ${CONTENT}}")
+    endforeach()
+endforeach()
+
+file(WRITE "${OUTPUT_DIR}/threads.json" "[${MERGED}]\n")
+message(STATUS "Thread scaling report written to ${OUTPUT_DIR}/threads.json")
@@ -0,0 +1,45 @@
+#include "Solver.hpp"
+
+namespace
+{
+	HarnessOptions SolverOptions(const std::string &name)
+	{
+		HarnessOptions options{};
+		options.inputPath = name;
+		return options;
+	}
+}
+
+Solver::Solver(std::string name, const std::function<void(Harness &)> &registration,
+               std::shared_ptr<PersistentState> persistent)
+		: _harness(name, SolverOptions(name))
+{
+	// Persistent state has to be in place before registration, days decide there whether to use it.
+	if (persistent)
+	{
+		_harness.SetPersistentState(std::move(persistent));
+	}
+	registration(_harness);
+}
+
+ResultValues Solver::Solve(std::string_view input)
+{
+	return Solve(std::make_shared<InputFile>(InputFile::View(input)));
+}
+
+ResultValues Solver::Solve(std::shared_ptr<const InputFile> input)
+{
+	_harness.UseInput(std::move(input));
+	_harness.Run();
+	return _harness.Results();
+}
+
+void Solver::SetPhaseHook(Harness::PhaseHook hook)
+{
+	_harness.SetPhaseHook(std::move(hook));
+}
+
+const std::string &Solver::Name() const
+{
+	return _harness.Name();
+}
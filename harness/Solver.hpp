@@ -0,0 +1,34 @@
+#ifndef ADVENTOFCODE2021_SOLVER_HPP
+#define ADVENTOFCODE2021_SOLVER_HPP
+
+#include "Harness.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// In-process entry point for embedding a day: registers it once and solves inputs that are already in
+// memory, without the measurement loop, report or result cache of a dayN run. The solver state the
+// registration creates is reused by every call. Not thread safe, use one Solver per thread; solvers
+// may share a PersistentState for memo tables.
+class Solver
+{
+public:
+	Solver(std::string name, const std::function<void(Harness &)> &registration,
+	       std::shared_ptr<PersistentState> persistent = nullptr);
+
+	// Parses and solves a text or packed input. The buffer is only read during the call.
+	[[nodiscard]] ResultValues Solve(std::string_view input);
+	[[nodiscard]] ResultValues Solve(std::shared_ptr<const InputFile> input);
+
+	// Receives the wall time of every phase, see Harness::SetPhaseHook.
+	void SetPhaseHook(Harness::PhaseHook hook);
+
+	[[nodiscard]] const std::string &Name() const;
+
+private:
+	Harness _harness;
+};
+
+#endif //ADVENTOFCODE2021_SOLVER_HPP
@@ -0,0 +1,36 @@
+# Writes OUTPUT_DIR/dayN/SolverVersion.hpp for every day, defining AOC_SOLVER_VERSION as a hash of the sources
+# the day's results depend on: its own directory plus shared/ and harness/, which every day links. Runs on every
+# build so added and removed files are picked up, a header is only rewritten when its hash changed so days whose
+# sources did not change are not recompiled.
+# Expects SOURCE_DIR, OUTPUT_DIR and DAYS to be defined.
+
+file(GLOB COMMON_SOURCES RELATIVE ${SOURCE_DIR}
+        ${SOURCE_DIR}/shared/*.cpp ${SOURCE_DIR}/shared/*.hpp ${SOURCE_DIR}/harness/*.cpp ${SOURCE_DIR}/harness/*.hpp)
+set(COMMON_HASHES "")
+foreach (source IN LISTS COMMON_SOURCES)
+    file(SHA1 ${SOURCE_DIR}/${source} SOURCE_HASH)
+    string(APPEND COMMON_HASHES "${source} ${SOURCE_HASH}\n")
+endforeach()
+
+foreach (index RANGE 1 ${DAYS})
+    file(GLOB DAY_SOURCES RELATIVE ${SOURCE_DIR} ${SOURCE_DIR}/day${index}/*.cpp ${SOURCE_DIR}/day${index}/*.hpp)
+    set(HASHES "${COMMON_HASHES}")
+    foreach (source IN LISTS DAY_SOURCES)
+        file(SHA1 ${SOURCE_DIR}/${source} SOURCE_HASH)
+        string(APPEND HASHES "${source} ${SOURCE_HASH}\n")
+    endforeach()
+    string(SHA1 VERSION "${HASHES}")
+    string(SUBSTRING ${VERSION} 0 16 VERSION)
+
+    set(HEADER "${OUTPUT_DIR}/day${index}/SolverVersion.hpp")
+    string(CONCAT CONTENT "#ifndef ADVENTOFCODE2021_SOLVERVERSION_HPP\n#define ADVENTOFCODE2021_SOLVERVERSION_HPP\n\n"
+            "// Generated by harness/SolverVersions.cmake.\n#define AOC_SOLVER_VERSION \"${VERSION}\"\n\n"
+            "#endif //ADVENTOFCODE2021_SOLVERVERSION_HPP\n")
+    set(PREVIOUS "")
+    if (EXISTS ${HEADER})
+        file(READ ${HEADER} PREVIOUS)
+    endif()
+    if (NOT PREVIOUS STREQUAL CONTENT)
+        file(WRITE ${HEADER} "${CONTENT}")
+    endif()
+endforeach()
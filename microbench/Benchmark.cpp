@@ -0,0 +1,342 @@
+#include "Benchmark.hpp"
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+	constexpr auto NameWidth = 36;
+	constexpr auto ColumnWidth = 14;
+	constexpr std::uint64_t MaxIterations = 1'000'000'000;
+
+	struct BenchmarkResult
+	{
+		std::string name;
+		std::int64_t size;
+		std::uint64_t iterations;
+		// Nanoseconds per iteration of every repetition.
+		std::vector<double> samples;
+		double itemsPerSecond;
+		double bytesPerSecond;
+	};
+
+	double ParseDouble(std::string_view value)
+	{
+		double result{};
+		const auto res = std::from_chars(value.data(), value.data() + value.size(), result);
+		if (res.ec != std::errc() || res.ptr != value.data() + value.size() || result < 0.0)
+		{
+			throw std::runtime_error("Invalid numeric argument");
+		}
+		return result;
+	}
+
+	BenchmarkState RunOnce(const Benchmark &benchmark, std::int64_t size, std::uint64_t iterations)
+	{
+		BenchmarkState state{size, iterations};
+		benchmark.function(state);
+		if (state.KeepRunning())
+		{
+			throw std::runtime_error(benchmark.name + " returned before running all iterations");
+		}
+		return state;
+	}
+
+	double PerSecond(std::uint64_t total, std::chrono::nanoseconds elapsed)
+	{
+		return elapsed.count() == 0 ? 0.0 : static_cast<double>(total) * 1e9 / static_cast<double>(elapsed.count());
+	}
+
+	BenchmarkResult Measure(const Benchmark &benchmark, std::int64_t size, const MicrobenchOptions &options)
+	{
+		// Grows the iteration count until a run is long enough to time, that run is the first repetition.
+		std::uint64_t iterations = 1;
+		auto state = RunOnce(benchmark, size, iterations);
+		while (state.Elapsed() < options.minTime && iterations < MaxIterations)
+		{
+			const auto elapsed = static_cast<double>(state.Elapsed().count());
+			const auto target = static_cast<double>(options.minTime.count()) * 1.4;
+			const auto multiplier = elapsed <= 0.0 ? 10.0 : std::min(10.0, target / elapsed);
+			iterations = std::min(MaxIterations,
+			                      std::max(iterations + 1, static_cast<std::uint64_t>(static_cast<double>(iterations) * multiplier)));
+			state = RunOnce(benchmark, size, iterations);
+		}
+
+		std::vector<BenchmarkState> runs{state};
+		while (runs.size() < options.repetitions)
+		{
+			runs.push_back(RunOnce(benchmark, size, iterations));
+		}
+		std::sort(runs.begin(), runs.end(), [](const auto &lhs, const auto &rhs)
+		{
+			return lhs.Elapsed() < rhs.Elapsed();
+		});
+
+		BenchmarkResult result{benchmark.name, size, iterations, {}, 0.0, 0.0};
+		for (const auto &run: runs)
+		{
+			result.samples.push_back(static_cast<double>(run.Elapsed().count()) / static_cast<double>(iterations));
+		}
+		const auto &median = runs[runs.size() / 2];
+		result.itemsPerSecond = PerSecond(median.ItemsProcessed(), median.Elapsed());
+		result.bytesPerSecond = PerSecond(median.BytesProcessed(), median.Elapsed());
+		return result;
+	}
+
+	std::string FullName(const std::string &name, std::int64_t size)
+	{
+		return name + "/" + std::to_string(size);
+	}
+
+	std::string FormatTime(double nanoseconds)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(1);
+		if (nanoseconds < 1e3)
+		{
+			stream << nanoseconds << "ns";
+		}
+		else if (nanoseconds < 1e6)
+		{
+			stream << nanoseconds / 1e3 << "us";
+		}
+		else
+		{
+			stream << nanoseconds / 1e6 << "ms";
+		}
+		return stream.str();
+	}
+
+	std::string FormatRate(double rate, std::string_view unit)
+	{
+		if (rate == 0.0)
+		{
+			return "-";
+		}
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(2);
+		if (rate < 1e3)
+		{
+			stream << rate << unit;
+		}
+		else if (rate < 1e6)
+		{
+			stream << rate / 1e3 << "k" << unit;
+		}
+		else if (rate < 1e9)
+		{
+			stream << rate / 1e6 << "M" << unit;
+		}
+		else
+		{
+			stream << rate / 1e9 << "G" << unit;
+		}
+		return stream.str();
+	}
+
+	void PrintHeader(std::ostream &os)
+	{
+		os << std::left << std::setw(NameWidth) << "Benchmark" << std::right << std::setw(ColumnWidth) << "time"
+		   << std::setw(ColumnWidth) << "iterations" << std::setw(ColumnWidth) << "items/s"
+		   << std::setw(ColumnWidth) << "bytes/s" << "\r\n";
+	}
+
+	void PrintResult(std::ostream &os, const BenchmarkResult &result)
+	{
+		os << std::left << std::setw(NameWidth) << FullName(result.name, result.size) << std::right
+		   << std::setw(ColumnWidth) << FormatTime(result.samples[result.samples.size() / 2])
+		   << std::setw(ColumnWidth) << result.iterations
+		   << std::setw(ColumnWidth) << FormatRate(result.itemsPerSecond, "")
+		   << std::setw(ColumnWidth) << FormatRate(result.bytesPerSecond, "B") << "\r\n";
+	}
+
+	void WriteJson(std::ostream &os, const std::vector<BenchmarkResult> &results)
+	{
+		os << "{\n";
+		os << "  \"benchmarks\": [\n";
+		for (auto i = 0U; i < results.size(); ++i)
+		{
+			const auto &result = results[i];
+			os << "    {\"name\": \"" << EscapeJson(FullName(result.name, result.size)) << "\", \"size\": "
+			   << result.size << ", \"iterations\": " << result.iterations << ", \"ns_per_iteration\": "
+			   << result.samples[result.samples.size() / 2] << ", \"items_per_second\": " << result.itemsPerSecond
+			   << ", \"bytes_per_second\": " << result.bytesPerSecond << ", \"samples_ns\": [";
+			for (auto j = 0U; j < result.samples.size(); ++j)
+			{
+				os << (j == 0 ? "" : ", ") << result.samples[j];
+			}
+			os << "]}" << (i + 1 == results.size() ? "\n" : ",\n");
+		}
+		os << "  ]\n";
+		os << "}\n";
+	}
+}
+
+BenchmarkState::BenchmarkState(std::int64_t size, std::uint64_t iterations)
+		: _size(size), _iterations(iterations)
+{}
+
+bool BenchmarkState::KeepRunning()
+{
+	if (!_started)
+	{
+		_started = true;
+		_start = Clock::now();
+	}
+	else if (_completed < _iterations)
+	{
+		++_completed;
+	}
+
+	if (_completed < _iterations)
+	{
+		return true;
+	}
+	if (!_paused)
+	{
+		_elapsed += Clock::now() - _start;
+		_paused = true;
+	}
+	return false;
+}
+
+void BenchmarkState::PauseTiming()
+{
+	if (!_paused)
+	{
+		_elapsed += Clock::now() - _start;
+		_paused = true;
+	}
+}
+
+void BenchmarkState::ResumeTiming()
+{
+	if (_paused)
+	{
+		_paused = false;
+		_start = Clock::now();
+	}
+}
+
+std::int64_t BenchmarkState::Size() const
+{
+	return _size;
+}
+
+std::uint64_t BenchmarkState::Iterations() const
+{
+	return _iterations;
+}
+
+void BenchmarkState::SetItemsProcessed(std::uint64_t items)
+{
+	_items = items;
+}
+
+void BenchmarkState::SetBytesProcessed(std::uint64_t bytes)
+{
+	_bytes = bytes;
+}
+
+std::chrono::nanoseconds BenchmarkState::Elapsed() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(_elapsed);
+}
+
+std::uint64_t BenchmarkState::ItemsProcessed() const
+{
+	return _items;
+}
+
+std::uint64_t BenchmarkState::BytesProcessed() const
+{
+	return _bytes;
+}
+
+MicrobenchOptions ParseMicrobenchOptions(int argc, char **argv)
+{
+	MicrobenchOptions options{};
+	for (auto i = 1; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		const auto next = [&]() -> std::string_view
+		{
+			if (i + 1 >= argc)
+			{
+				throw std::runtime_error("Missing value for argument");
+			}
+			return argv[++i];
+		};
+
+		if (argument == "--filter")
+		{
+			options.filter = std::string{next()};
+		}
+		else if (argument == "--min-time")
+		{
+			options.minTime = std::chrono::nanoseconds{static_cast<std::int64_t>(ParseDouble(next()) * 1e9)};
+		}
+		else if (argument == "--repetitions")
+		{
+			options.repetitions = std::max<std::size_t>(static_cast<std::size_t>(ParseDouble(next())), 1);
+		}
+		else if (argument == "--json")
+		{
+			options.jsonPath = std::string{next()};
+		}
+		else if (argument == "--list")
+		{
+			options.list = true;
+		}
+		else
+		{
+			throw std::runtime_error("Usage: aoc_microbench [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--json PATH] [--list]");
+		}
+	}
+	return options;
+}
+
+int RunBenchmarks(const std::vector<Benchmark> &benchmarks, const MicrobenchOptions &options)
+{
+	std::vector<BenchmarkResult> results;
+	if (!options.list)
+	{
+		PrintHeader(std::cout);
+	}
+	for (const auto &benchmark: benchmarks)
+	{
+		for (const auto size: benchmark.sizes)
+		{
+			const auto name = FullName(benchmark.name, size);
+			if (options.filter.has_value() && name.find(*options.filter) == std::string::npos)
+			{
+				continue;
+			}
+			if (options.list)
+			{
+				std::cout << name << "\r\n";
+				continue;
+			}
+			results.push_back(Measure(benchmark, size, options));
+			PrintResult(std::cout, results.back());
+		}
+	}
+
+	if (options.jsonPath.has_value())
+	{
+		std::ofstream file(*options.jsonPath);
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		WriteJson(file, results);
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+#ifndef ADVENTOFCODE2021_BENCHMARK_HPP
+#define ADVENTOFCODE2021_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Keeps the compiler from discarding a value that is only computed for the benchmark.
+template<class T>
+inline void DoNotOptimize(const T &value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Passed to a benchmark body, which loops on KeepRunning() around the code being measured:
+//   while (state.KeepRunning()) { ... }
+// Setup that has to be redone every iteration goes between PauseTiming() and ResumeTiming().
+class BenchmarkState
+{
+public:
+	BenchmarkState(std::int64_t size, std::uint64_t iterations);
+
+	[[nodiscard]] bool KeepRunning();
+	void PauseTiming();
+	void ResumeTiming();
+
+	// Size parameter of this run, what it counts is up to the benchmark.
+	[[nodiscard]] std::int64_t Size() const;
+	[[nodiscard]] std::uint64_t Iterations() const;
+
+	// Totals over all iterations, reported per second of measured time.
+	void SetItemsProcessed(std::uint64_t items);
+	void SetBytesProcessed(std::uint64_t bytes);
+
+	[[nodiscard]] std::chrono::nanoseconds Elapsed() const;
+	[[nodiscard]] std::uint64_t ItemsProcessed() const;
+	[[nodiscard]] std::uint64_t BytesProcessed() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	std::int64_t _size;
+	std::uint64_t _iterations;
+	std::uint64_t _completed = 0;
+	bool _started = false;
+	bool _paused = false;
+	Clock::time_point _start;
+	Clock::duration _elapsed{};
+	std::uint64_t _items = 0;
+	std::uint64_t _bytes = 0;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkState &)>;
+
+struct Benchmark
+{
+	std::string name;
+	BenchmarkFunction function;
+	// Every size is run and reported separately as name/size.
+	std::vector<std::int64_t> sizes;
+};
+
+struct MicrobenchOptions
+{
+	// Only benchmarks whose name/size contains this are run.
+	std::optional<std::string> filter;
+	// Iterations are scaled up until one repetition takes at least this long.
+	std::chrono::nanoseconds minTime = std::chrono::milliseconds(500);
+	std::size_t repetitions = 1;
+	std::optional<std::string> jsonPath;
+	bool list = false;
+};
+
+// Accepts: [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--json PATH] [--list]
+[[nodiscard]] MicrobenchOptions ParseMicrobenchOptions(int argc, char **argv);
+
+// Runs the selected benchmarks, prints a table and writes the JSON report if requested.
+int RunBenchmarks(const std::vector<Benchmark> &benchmarks, const MicrobenchOptions &options);
+
+#endif //ADVENTOFCODE2021_BENCHMARK_HPP
@@ -0,0 +1,632 @@
+#include "CoreBenchmarks.hpp"
+
+#include "day1/DepthAnalyzer.hpp"
+#include "day1/WindowIncreases.hpp"
+#include "day2/Course.hpp"
+#include "day2/CourseScan.hpp"
+#include "day4/BingoBaord.hpp"
+#include "day5/Map.hpp"
+#include "day15/Graph.hpp"
+#include "day16/Parser.hpp"
+#include "day18/Node.hpp"
+#include "day19/Scanner.hpp"
+#include "day20/Image.hpp"
+#include "day22/Cuboid.hpp"
+#include "day23/Burrow.hpp"
+#include "day24/ALU.hpp"
+#include "day25/Cucumbers.hpp"
+#include "Generators.hpp"
+#include "IntegerList.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+	// Fixed seed, every run measures the same data.
+	constexpr std::uint64_t Seed = 2021;
+
+	std::size_t SizeOf(const BenchmarkState &state)
+	{
+		return static_cast<std::size_t>(state.Size());
+	}
+
+	// Input lines of the given day from the aoc_gen generator.
+	std::vector<std::string> GenerateLines(std::size_t day, std::size_t size, Random &random)
+	{
+		std::ostringstream text;
+		GetGenerator(day).generate(text, size, random);
+
+		std::vector<std::string> lines;
+		std::string line;
+		std::istringstream stream{text.str()};
+		while (std::getline(stream, line))
+		{
+			lines.push_back(std::move(line));
+		}
+		return lines;
+	}
+
+	std::vector<std::uint16_t> RandomDepths(std::size_t count)
+	{
+		Random random{Seed};
+		std::vector<std::uint16_t> depths(count);
+		for (auto &depth: depths)
+		{
+			depth = static_cast<std::uint16_t>(random.Uniform(0, 10000));
+		}
+		return depths;
+	}
+
+	// Size: number of depth readings, compared three apart like part 2.
+	void CountWindowIncreases(BenchmarkState &state)
+	{
+		const auto depths = RandomDepths(SizeOf(state));
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(day1::CountWindowIncreases(depths, 3));
+		}
+		state.SetItemsProcessed(SizeOf(state) * state.Iterations());
+		state.SetBytesProcessed(SizeOf(state) * sizeof(std::uint16_t) * state.Iterations());
+	}
+
+	void PushInBatches(day1::DepthAnalyzer<std::uint16_t> &analyzer, const std::vector<std::uint16_t> &depths,
+	                   std::size_t batch)
+	{
+		for (std::size_t i = 0; i < depths.size(); i += batch)
+		{
+			analyzer.Push(std::span{depths}.subspan(i, std::min(batch, depths.size() - i)));
+		}
+	}
+
+	// The batch overload must count exactly what pushing the same readings one at a time counts,
+	// checked once before timing so a wrong fast path is never measured.
+	void CheckBatchPush(const std::vector<std::uint16_t> &depths, std::size_t batch, std::size_t part1Window,
+	                    std::size_t part2Window)
+	{
+		day1::DepthAnalyzer<std::uint16_t> batched{part1Window, part2Window};
+		day1::DepthAnalyzer<std::uint16_t> single{part1Window, part2Window};
+		PushInBatches(batched, depths, batch);
+		for (const auto depth: depths)
+		{
+			single.Push(depth);
+		}
+		if (batched.Part1() != single.Part1() || batched.Part2() != single.Part2() ||
+		    batched.Count() != single.Count())
+		{
+			throw std::runtime_error("Batch push disagrees with single readings");
+		}
+	}
+
+	// Size: readings per Push, 1 takes the single reading overload. 1M readings with the default windows.
+	void DepthAnalyzerPush(BenchmarkState &state)
+	{
+		const auto depths = RandomDepths(std::size_t{1} << 20);
+		const auto batch = SizeOf(state);
+		CheckBatchPush(depths, batch, 1, 3);
+		while (state.KeepRunning())
+		{
+			day1::DepthAnalyzer<std::uint16_t> analyzer;
+			if (batch == 1)
+			{
+				for (const auto depth: depths)
+				{
+					analyzer.Push(depth);
+				}
+			}
+			else
+			{
+				PushInBatches(analyzer, depths, batch);
+			}
+			DoNotOptimize(analyzer.Part2());
+		}
+		state.SetItemsProcessed(depths.size() * state.Iterations());
+	}
+
+	// Size: part 2 window, 1M readings pushed in batches of 4096 with a part 1 window of 1.
+	void DepthAnalyzerWindow(BenchmarkState &state)
+	{
+		constexpr std::size_t Batch = 4096;
+		const auto depths = RandomDepths(std::size_t{1} << 20);
+		CheckBatchPush(depths, Batch, 1, SizeOf(state));
+		while (state.KeepRunning())
+		{
+			day1::DepthAnalyzer<std::uint16_t> analyzer{1, SizeOf(state)};
+			PushInBatches(analyzer, depths, Batch);
+			DoNotOptimize(analyzer.Part2());
+		}
+		state.SetItemsProcessed(depths.size() * state.Iterations());
+	}
+
+	// Size: worker count, counting 32M readings in chunks.
+	void ParallelCountWindowIncreases(BenchmarkState &state)
+	{
+		const auto depths = RandomDepths(std::size_t{1} << 25);
+		ThreadPool pool{SizeOf(state)};
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(day1::CountWindowIncreases(depths, 3, pool));
+		}
+		state.SetItemsProcessed(depths.size() * state.Iterations());
+		state.SetBytesProcessed(depths.size() * sizeof(std::uint16_t) * state.Iterations());
+	}
+
+	// Size: worker count, parsing a 4M line day 1 input.
+	void ParallelParseDepths(BenchmarkState &state)
+	{
+		std::string text;
+		for (const auto depth: RandomDepths(std::size_t{1} << 22))
+		{
+			text += std::to_string(depth);
+			text += '\n';
+		}
+		ThreadPool pool{SizeOf(state)};
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(ParseIntegerListParallel<std::uint16_t>(text, pool));
+		}
+		state.SetItemsProcessed((std::size_t{1} << 22) * state.Iterations());
+		state.SetBytesProcessed(text.size() * state.Iterations());
+	}
+
+	day2::Course RandomCourse(std::size_t size)
+	{
+		Random random{Seed};
+		day2::Course course;
+		for (auto i = 0U; i < size; ++i)
+		{
+			course.Add(static_cast<day2::Opcode>(random.Uniform(0, 2)), static_cast<std::uint16_t>(random.Uniform(1, 9)));
+		}
+		return course;
+	}
+
+	// Size: number of commands, a third each forward, down and up.
+	void CourseEvaluate(BenchmarkState &state)
+	{
+		const auto course = RandomCourse(SizeOf(state));
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(day2::Evaluate(course));
+		}
+		state.SetItemsProcessed(SizeOf(state) * state.Iterations());
+	}
+
+	// Size: worker count, composing the blocks of a 16M command course.
+	void CourseEvaluateParallel(BenchmarkState &state)
+	{
+		const auto course = RandomCourse(std::size_t{1} << 24);
+		ThreadPool pool{SizeOf(state)};
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(day2::EvaluateParallel(course, pool));
+		}
+		state.SetItemsProcessed(course.Size() * state.Iterations());
+	}
+
+	// Size: block size of the scan, random prefix state lookups into a 1M command course.
+	void CourseScanAt(BenchmarkState &state)
+	{
+		constexpr std::size_t Queries = 1024;
+		auto course = RandomCourse(std::size_t{1} << 20);
+		const auto commands = course.Size();
+		ThreadPool pool{1};
+		const day2::CourseScan scan{std::move(course), pool, SizeOf(state)};
+
+		Random random{Seed};
+		std::vector<std::size_t> steps(Queries);
+		for (auto &step: steps)
+		{
+			step = static_cast<std::size_t>(random.Uniform(0, static_cast<std::int64_t>(commands)));
+		}
+
+		while (state.KeepRunning())
+		{
+			for (const auto step: steps)
+			{
+				DoNotOptimize(scan.At(step));
+			}
+		}
+		state.SetItemsProcessed(Queries * state.Iterations());
+	}
+
+	// Size: number of boards, every board is marked until it wins.
+	void BoardMarkNumber(BenchmarkState &state)
+	{
+		Random random{Seed};
+		std::vector<std::uint8_t> draws(100);
+		std::iota(draws.begin(), draws.end(), 0);
+		random.Shuffle(draws);
+
+		std::vector<day4::Board> boards;
+		for (auto i = 0U; i < SizeOf(state); ++i)
+		{
+			auto elements = draws;
+			random.Shuffle(elements);
+			elements.resize(25);
+			boards.emplace_back(static_cast<std::uint8_t>(i), elements);
+		}
+
+		std::uint64_t marks = 0;
+		while (state.KeepRunning())
+		{
+			state.PauseTiming();
+			auto fresh = boards;
+			state.ResumeTiming();
+
+			for (auto &board: fresh)
+			{
+				for (const auto number: draws)
+				{
+					++marks;
+					if (board.MarkNumber(number).has_value())
+					{
+						break;
+					}
+				}
+			}
+			DoNotOptimize(fresh);
+		}
+		state.SetItemsProcessed(marks);
+	}
+
+	// Size: number of lines on a puzzle sized 1000x1000 map, a third each horizontal, vertical and diagonal.
+	void MapDrawLine(BenchmarkState &state)
+	{
+		constexpr std::int64_t MapSize = 999;
+		Random random{Seed};
+		std::vector<day5::Line> lines;
+		std::uint64_t points = 0;
+		for (auto i = 0U; i < SizeOf(state); ++i)
+		{
+			const auto x = random.Uniform(0, MapSize);
+			const auto y = random.Uniform(0, MapSize);
+			auto length = random.Uniform(0, MapSize);
+			auto end = std::make_pair(x, y);
+			switch (i % 3)
+			{
+				case 0:
+					end.first = random.Uniform(0, MapSize);
+					break;
+				case 1:
+					end.second = random.Uniform(0, MapSize);
+					break;
+				default:
+					length = std::min({length, MapSize - x, MapSize - y});
+					end = {x + length, y + length};
+					break;
+			}
+			points += static_cast<std::uint64_t>(std::max(std::abs(end.first - x), std::abs(end.second - y))) + 1;
+			lines.emplace_back(day5::Line::Point(x, y), day5::Line::Point(end.first, end.second));
+		}
+
+		day5::Map map{MapSize};
+		while (state.KeepRunning())
+		{
+			for (const auto &line: lines)
+			{
+				map.DrawLine(line);
+			}
+		}
+		DoNotOptimize(map);
+		state.SetItemsProcessed(points * state.Iterations());
+	}
+
+	// Size: width and height of the cave.
+	void GraphShortestPath(BenchmarkState &state)
+	{
+		Random random{Seed};
+		day15::Cave cave{SizeOf(state), SizeOf(state), 1};
+		for (auto y = 0U; y < cave.Height(); ++y)
+		{
+			for (auto x = 0U; x < cave.Width(); ++x)
+			{
+				cave(x, y) = static_cast<std::uint8_t>(random.Uniform(1, 9));
+			}
+		}
+
+		const day15::Graph graph{cave};
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(graph.ShortestPath());
+		}
+		state.SetItemsProcessed(cave.Width() * cave.Height() * state.Iterations());
+	}
+
+	void AppendBits(std::vector<std::uint8_t> &bits, std::uint64_t value, std::size_t count)
+	{
+		for (auto i = count; i > 0; --i)
+		{
+			bits.push_back(static_cast<std::uint8_t>(value >> (i - 1) & 1));
+		}
+	}
+
+	// Sum operators of up to four sub-packets counted by number, down to the literals.
+	void AppendPacket(std::vector<std::uint8_t> &bits, std::size_t literals, Random &random)
+	{
+		AppendBits(bits, static_cast<std::uint64_t>(random.Uniform(0, 7)), 3);
+		if (literals == 1)
+		{
+			AppendBits(bits, 4, 3);
+			const auto groups = random.Uniform(1, 4);
+			for (auto group = 0; group < groups; ++group)
+			{
+				AppendBits(bits, group + 1 < groups ? 1 : 0, 1);
+				AppendBits(bits, static_cast<std::uint64_t>(random.Uniform(0, 15)), 4);
+			}
+			return;
+		}
+
+		const auto children = std::min<std::size_t>(literals, 4);
+		AppendBits(bits, 0, 3);
+		AppendBits(bits, 1, 1);
+		AppendBits(bits, children, 11);
+		for (auto child = 0U; child < children; ++child)
+		{
+			AppendPacket(bits, literals / children + (child < literals % children ? 1 : 0), random);
+		}
+	}
+
+	// Size: number of literal packets in the transmission.
+	void ParserParsePackets(BenchmarkState &state)
+	{
+		Random random{Seed};
+		std::vector<std::uint8_t> bits;
+		AppendPacket(bits, SizeOf(state), random);
+
+		while (state.KeepRunning())
+		{
+			day16::Parser parser{};
+			DoNotOptimize(parser.ParsePackets(bits));
+		}
+		state.SetItemsProcessed(SizeOf(state) * state.Iterations());
+		state.SetBytesProcessed(bits.size() / 8 * state.Iterations());
+	}
+
+	// Size: number of additions, each reduces the sum of two random numbers.
+	void NodeReduce(BenchmarkState &state)
+	{
+		Random random{Seed};
+		std::vector<std::unique_ptr<day18::Node>> numbers;
+		for (const auto &number: GenerateLines(18, SizeOf(state) * 2, random))
+		{
+			numbers.push_back(day18::NodeParser{}.Parse(number));
+		}
+
+		std::vector<std::unique_ptr<day18::Node>> sums;
+		while (state.KeepRunning())
+		{
+			state.PauseTiming();
+			sums.clear();
+			for (auto i = 0U; i < numbers.size(); i += 2)
+			{
+				auto sum = std::make_unique<day18::Node>(day18::NodeOrientation::Top, std::make_pair(nullptr, nullptr));
+				auto left = numbers[i]->Copy();
+				left->SetParent(sum.get());
+				left->SetOrientation(day18::NodeOrientation::Left);
+				auto right = numbers[i + 1]->Copy();
+				right->SetParent(sum.get());
+				right->SetOrientation(day18::NodeOrientation::Right);
+				sum->SetNested(std::make_pair(std::move(left), std::move(right)));
+				sums.push_back(std::move(sum));
+			}
+			state.ResumeTiming();
+
+			for (auto &sum: sums)
+			{
+				sum->Reduce();
+			}
+		}
+		DoNotOptimize(sums);
+		state.SetItemsProcessed(SizeOf(state) * state.Iterations());
+	}
+
+	// Size: number of beacons seen by the scanner.
+	void ScannerGetAllRotations(BenchmarkState &state)
+	{
+		Random random{Seed};
+		day19::Scanner scanner{"--- scanner 0 ---", {}};
+		for (auto i = 0U; i < SizeOf(state); ++i)
+		{
+			scanner.beacons.push_back({static_cast<std::int32_t>(random.Uniform(-1000, 1000)),
+			                           static_cast<std::int32_t>(random.Uniform(-1000, 1000)),
+			                           static_cast<std::int32_t>(random.Uniform(-1000, 1000))});
+		}
+
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(scanner.GetAllRotations());
+		}
+		state.SetItemsProcessed(SizeOf(state) * 24 * state.Iterations());
+	}
+
+	// Size: width and height of the input image, enhanced twice like part 1.
+	void ImageEnhance(BenchmarkState &state)
+	{
+		constexpr std::size_t Steps = 2;
+		Random random{Seed};
+		day20::Algorithm algorithm{};
+		for (auto &bit: algorithm)
+		{
+			bit = random.Uniform(0, 1) == 1;
+		}
+		Grid2D<std::uint8_t> pixels{SizeOf(state), SizeOf(state)};
+		for (auto y = 0U; y < pixels.Height(); ++y)
+		{
+			for (auto x = 0U; x < pixels.Width(); ++x)
+			{
+				pixels(x, y) = static_cast<std::uint8_t>(random.Uniform(0, 1));
+			}
+		}
+
+		while (state.KeepRunning())
+		{
+			state.PauseTiming();
+			day20::Image image{pixels, Steps};
+			state.ResumeTiming();
+
+			for (auto step = 0U; step < Steps; ++step)
+			{
+				image.Enhance(algorithm);
+			}
+			DoNotOptimize(image);
+		}
+		const auto side = SizeOf(state) + 2 * Steps;
+		state.SetItemsProcessed(side * side * Steps * state.Iterations());
+	}
+
+	// Size: number of overlapping cuboid pairs split up.
+	void CuboidRemoveIntersection(BenchmarkState &state)
+	{
+		Random random{Seed};
+		const auto range = [&random](std::int64_t centre)
+		{
+			const auto low = centre - random.Uniform(1, 20000);
+			return std::make_pair(low, centre + random.Uniform(1, 20000));
+		};
+
+		std::vector<std::pair<day22::Cuboid, day22::Cuboid>> pairs;
+		for (auto i = 0U; i < SizeOf(state); ++i)
+		{
+			// Both contain the centre, so every pair intersects.
+			const auto x = random.Uniform(-50000, 50000);
+			const auto y = random.Uniform(-50000, 50000);
+			const auto z = random.Uniform(-50000, 50000);
+			pairs.emplace_back(day22::Cuboid{range(x), range(y), range(z)}, day22::Cuboid{range(x), range(y), range(z)});
+		}
+
+		while (state.KeepRunning())
+		{
+			for (const auto &[cuboid, other]: pairs)
+			{
+				DoNotOptimize(cuboid.RemoveIntersection(other));
+			}
+		}
+		state.SetItemsProcessed(SizeOf(state) * state.Iterations());
+	}
+
+	template<std::size_t N>
+	std::uint64_t SolveBurrow()
+	{
+		// The example burrow from the puzzle, with the two extra rows of part 2 for N = 4.
+		const std::array<std::array<char, 4>, 4> rows{{{'B', 'D', 'D', 'A'}, {'C', 'C', 'B', 'D'},
+		                                               {'B', 'B', 'A', 'C'}, {'D', 'A', 'C', 'A'}}};
+		std::array<std::array<char, N>, 4> initialState{};
+		for (auto room = 0U; room < 4; ++room)
+		{
+			for (auto i = 0U; i < N; ++i)
+			{
+				initialState[room][i] = rows[room][N == 2 ? i * 3 : i];
+			}
+		}
+		return day23::Burrow<N>{initialState}.Solve();
+	}
+
+	// Size: depth N of the rooms, 2 for part 1 and 4 for part 2.
+	void BurrowSolve(BenchmarkState &state)
+	{
+		if (state.Size() != 2 && state.Size() != 4)
+		{
+			throw std::runtime_error("Burrow depth must be 2 or 4");
+		}
+		while (state.KeepRunning())
+		{
+			DoNotOptimize(state.Size() == 2 ? SolveBurrow<2>() : SolveBurrow<4>());
+		}
+		state.SetItemsProcessed(state.Iterations());
+	}
+
+	// Size: number of model numbers run through the program.
+	void ALUApplyInstruction(BenchmarkState &state)
+	{
+		Random random{Seed};
+		// Fourteen blocks reading one digit each, seven of them push onto z and seven pop.
+		std::vector<day24::Instruction> program;
+		for (const auto &line: GenerateLines(24, 7, random))
+		{
+			program.push_back(day24::ParseInstruction(line));
+		}
+		std::vector<std::int64_t> digits(SizeOf(state) * 14);
+		for (auto &digit: digits)
+		{
+			digit = random.Uniform(1, 9);
+		}
+
+		std::uint64_t applied = 0;
+		while (state.KeepRunning())
+		{
+			auto digit = digits.cbegin();
+			for (auto number = 0U; number < SizeOf(state); ++number)
+			{
+				day24::ALU alu{};
+				for (const auto &instruction: program)
+				{
+					if (instruction.op == day24::Op::Inp)
+					{
+						alu.ApplyInputInstruction(instruction, *digit++);
+					}
+					else
+					{
+						alu.ApplyInstruction(instruction);
+						++applied;
+					}
+				}
+				DoNotOptimize(alu);
+			}
+		}
+		state.SetItemsProcessed(applied);
+	}
+
+	// Size: width and height of the sea floor, a third of it each empty, east and south facing.
+	void CucumberFieldStep(BenchmarkState &state)
+	{
+		Random random{Seed};
+		std::vector<std::vector<char>> input;
+		for (const auto &line: GenerateLines(25, SizeOf(state), random))
+		{
+			input.emplace_back(line.begin(), line.end());
+		}
+
+		// Once the herds have stopped the field starts over, steps without movement are not representative.
+		day25::CucumberField field{input};
+		while (state.KeepRunning())
+		{
+			if (!field.Step())
+			{
+				state.PauseTiming();
+				field = day25::CucumberField{input};
+				state.ResumeTiming();
+			}
+		}
+		DoNotOptimize(field);
+		state.SetItemsProcessed(SizeOf(state) * SizeOf(state) * state.Iterations());
+	}
+}
+
+std::vector<Benchmark> CoreBenchmarks()
+{
+	return {
+			{"CountWindowIncreases", CountWindowIncreases, {1 << 10, 1 << 16, 1 << 24}},
+			{"ParallelCountWindowIncreases", ParallelCountWindowIncreases, {1, 2, 4, 8}},
+			{"DepthAnalyzer::Push", DepthAnalyzerPush, {1, 64, 4096}},
+			{"DepthAnalyzer::Push(window)", DepthAnalyzerWindow, {3, 100, 10000}},
+			{"ParallelParseDepths", ParallelParseDepths, {1, 2, 4, 8}},
+			{"Course::Evaluate", CourseEvaluate, {1000, 1 << 16, 1 << 22}},
+			{"EvaluateParallel", CourseEvaluateParallel, {1, 2, 4, 8}},
+			{"CourseScan::At", CourseScanAt, {256, 4096, 65536}},
+			{"Board::MarkNumber", BoardMarkNumber, {10, 100, 1000}},
+			{"Map::DrawLine", MapDrawLine, {100, 500, 2000}},
+			{"Graph::ShortestPath", GraphShortestPath, {50, 100, 500}},
+			{"Parser::ParsePackets", ParserParsePackets, {64, 1024, 16384}},
+			{"Node::Reduce", NodeReduce, {10, 100, 1000}},
+			{"Scanner::GetAllRotations", ScannerGetAllRotations, {10, 26, 100}},
+			{"Image::Enhance", ImageEnhance, {100, 200, 800}},
+			{"Cuboid::RemoveIntersection", CuboidRemoveIntersection, {10, 100, 1000}},
+			{"Burrow<N>::Solve", BurrowSolve, {2, 4}},
+			{"ALU::ApplyInstruction", ALUApplyInstruction, {1, 16, 256}},
+			{"CucumberField::Step", CucumberFieldStep, {50, 139, 500}},
+	};
+}
@@ -0,0 +1,11 @@
+#ifndef ADVENTOFCODE2021_COREBENCHMARKS_HPP
+#define ADVENTOFCODE2021_COREBENCHMARKS_HPP
+
+#include "Benchmark.hpp"
+
+#include <vector>
+
+// The building blocks of the days measured in isolation on generated data, one benchmark per class.
+[[nodiscard]] std::vector<Benchmark> CoreBenchmarks();
+
+#endif //ADVENTOFCODE2021_COREBENCHMARKS_HPP
@@ -0,0 +1,10 @@
+#include "Benchmark.hpp"
+#include "CoreBenchmarks.hpp"
+
+// Microbenchmarks of the core data structures, separate from the whole-day timings of the harness.
+// Usage: aoc_microbench [--filter TEXT] [--min-time SECONDS] [--repetitions N] [--json PATH] [--list]
+int main(int argc, char **argv)
+{
+	const auto options = ParseMicrobenchOptions(argc, argv);
+	return RunBenchmarks(CoreBenchmarks(), options);
+}
@@ -0,0 +1,90 @@
+#include "Days.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	const Day &FindPackableDay(std::string_view name)
+	{
+		const auto &day = FindDay(name);
+		if (day.pack == nullptr)
+		{
+			throw std::runtime_error(std::string{day.name} + " has no packed input format");
+		}
+		return day;
+	}
+}
+
+// Converts a text puzzle input to the day's packed binary input, which the dayN binaries load without
+// parsing text. Packing is worth it for inputs that are solved many times.
+// Usage: aoc_pack [--output PATH] DAY INPUT
+//        aoc_pack --list
+int main(int argc, char **argv)
+{
+	std::optional<std::string> output;
+	std::optional<std::string> day;
+	std::optional<std::string> input;
+
+	for (auto i = 1; i < argc; ++i)
+	{
+		const std::string_view argument{argv[i]};
+		if (argument == "--list")
+		{
+			for (const auto &entry: AllDays())
+			{
+				if (entry.pack != nullptr)
+				{
+					std::cout << entry.name << "\r\n";
+				}
+			}
+			return 0;
+		}
+		else if (argument == "--output")
+		{
+			if (i + 1 >= argc)
+			{
+				throw std::runtime_error("Missing value for argument");
+			}
+			output = argv[++i];
+		}
+		else if (argument.starts_with("--"))
+		{
+			throw std::runtime_error("Unknown argument");
+		}
+		else if (!day.has_value())
+		{
+			day = std::string{argument};
+		}
+		else
+		{
+			input = std::string{argument};
+		}
+	}
+
+	if (!day.has_value() || !input.has_value())
+	{
+		throw std::runtime_error("Usage: aoc_pack [--output PATH] DAY INPUT");
+	}
+
+	const auto packed = FindPackableDay(*day).pack(InputFile{*input});
+	if (output.has_value())
+	{
+		std::ofstream file(*output, std::ios::binary);
+		file.write(packed.data(), static_cast<std::streamsize>(packed.size()));
+		if (!file.good())
+		{
+			throw std::runtime_error("Failed to write file");
+		}
+	}
+	else
+	{
+		std::cout.write(packed.data(), static_cast<std::streamsize>(packed.size()));
+	}
+
+	return 0;
+}
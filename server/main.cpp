@@ -0,0 +1,482 @@
+#include "Days.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+	// Longest request header accepted, the path of a SOLVE request included.
+	constexpr std::size_t MaxLineLength = 4096;
+
+	volatile std::sig_atomic_t stopRequested = 0;
+
+	void RequestStop(int)
+	{
+		stopRequested = 1;
+	}
+
+	struct ServerOptions
+	{
+		std::string socketPath = "/tmp/aoc.sock";
+		std::size_t warmup = 0;
+		std::size_t iterations = 1;
+		std::size_t maxInlineBytes = std::size_t{32} << 20;
+		std::size_t maxClients = 16;
+	};
+
+	std::size_t ParseCount(std::string_view value)
+	{
+		std::size_t result{};
+		const auto res = std::from_chars(value.data(), value.data() + value.size(), result);
+		if (res.ec != std::errc() || res.ptr != value.data() + value.size())
+		{
+			throw std::runtime_error("Invalid numeric argument");
+		}
+		return result;
+	}
+
+	constexpr auto Usage = "Usage: aoc_server [--socket PATH] [--warmup N] [--iterations N] [--max-inline BYTES] "
+	                       "[--max-clients N]";
+
+	// Accepts: [--socket PATH] [--warmup N] [--iterations N] [--max-inline BYTES] [--max-clients N]
+	ServerOptions ParseServerOptions(int argc, char **argv)
+	{
+		ServerOptions options{};
+		for (auto i = 1; i < argc; ++i)
+		{
+			const std::string_view argument{argv[i]};
+			if (i + 1 >= argc)
+			{
+				throw std::runtime_error(Usage);
+			}
+			if (argument == "--socket")
+			{
+				options.socketPath = argv[++i];
+			}
+			else if (argument == "--warmup")
+			{
+				options.warmup = ParseCount(argv[++i]);
+			}
+			else if (argument == "--iterations")
+			{
+				options.iterations = std::max<std::size_t>(ParseCount(argv[++i]), 1);
+			}
+			else if (argument == "--max-inline")
+			{
+				options.maxInlineBytes = ParseCount(argv[++i]);
+			}
+			else if (argument == "--max-clients")
+			{
+				options.maxClients = std::max<std::size_t>(ParseCount(argv[++i]), 1);
+			}
+			else
+			{
+				throw std::runtime_error(Usage);
+			}
+		}
+		return options;
+	}
+
+	// Inputs requested by path stay loaded until the file changes on disk.
+	class InputCache
+	{
+	public:
+		std::shared_ptr<const InputFile> Get(const std::string &path)
+		{
+			struct stat info{};
+			if (::stat(path.c_str(), &info) != 0)
+			{
+				throw std::runtime_error("Failed to open file");
+			}
+
+			std::lock_guard lock(_mutex);
+			auto &entry = _entries[path];
+			if (!entry.input || entry.modified != info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec ||
+			    entry.size != info.st_size)
+			{
+				entry.input = std::make_shared<InputFile>(path);
+				entry.modified = info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec;
+				entry.size = info.st_size;
+			}
+			return entry.input;
+		}
+
+	private:
+		struct Entry
+		{
+			std::shared_ptr<const InputFile> input;
+			std::int64_t modified = 0;
+			off_t size = 0;
+		};
+
+		std::mutex _mutex;
+		std::map<std::string, Entry> _entries;
+	};
+
+	class Connection
+	{
+	public:
+		explicit Connection(int fd) : _fd(fd)
+		{}
+
+		// Returns false on end of stream.
+		bool ReadLine(std::string &line)
+		{
+			std::size_t searched = 0;
+			while (true)
+			{
+				const auto newline = std::find(_buffer.begin() + static_cast<std::ptrdiff_t>(searched), _buffer.end(), '\n');
+				if (newline != _buffer.end())
+				{
+					line.assign(_buffer.begin(), newline);
+					_buffer.erase(_buffer.begin(), newline + 1);
+					return true;
+				}
+				searched = _buffer.size();
+				if (searched > MaxLineLength)
+				{
+					throw std::runtime_error("Request line too long");
+				}
+				if (!Fill())
+				{
+					return false;
+				}
+			}
+		}
+
+		// Bytes already buffered are taken first, the rest is received straight into the result.
+		std::vector<char> ReadExact(std::size_t count)
+		{
+			const auto buffered = std::min(count, _buffer.size());
+			std::vector<char> result(count);
+			std::copy_n(_buffer.begin(), buffered, result.begin());
+			_buffer.erase(_buffer.begin(), _buffer.begin() + static_cast<std::ptrdiff_t>(buffered));
+
+			for (auto filled = buffered; filled < count;)
+			{
+				const auto received = ::recv(_fd, result.data() + filled, count - filled, 0);
+				if (received <= 0)
+				{
+					throw std::runtime_error("Connection closed");
+				}
+				filled += static_cast<std::size_t>(received);
+			}
+			return result;
+		}
+
+		void Write(std::string_view data)
+		{
+			while (!data.empty())
+			{
+				const auto count = ::send(_fd, data.data(), data.size(), MSG_NOSIGNAL);
+				if (count < 0)
+				{
+					throw std::runtime_error("Failed to write to socket");
+				}
+				data.remove_prefix(static_cast<std::size_t>(count));
+			}
+		}
+
+	private:
+		bool Fill()
+		{
+			char chunk[1 << 16];
+			const auto count = ::recv(_fd, chunk, sizeof(chunk), 0);
+			if (count <= 0)
+			{
+				return false;
+			}
+			_buffer.insert(_buffer.end(), chunk, chunk + count);
+			return true;
+		}
+
+	private:
+		int _fd;
+		std::vector<char> _buffer;
+	};
+
+	class Server
+	{
+	public:
+		explicit Server(ServerOptions options) : _options(std::move(options)),
+		                                         _persistent(std::make_shared<PersistentState>())
+		{}
+
+		// Protocol, one request per line:
+		//   SOLVE <day> <path>                 solves a file readable by the server
+		//   SOLVE_INLINE <day> <bytes>\n<data>  solves the bytes that follow the header
+		//   QUIT                               closes the connection
+		// Every request is answered with "OK <bytes>\n" followed by the harness JSON, or "ERROR <message>\n".
+		void Serve(int fd)
+		{
+			Connection connection{fd};
+			try
+			{
+				Serve(connection);
+			}
+			catch (const std::exception &e)
+			{
+				// The stream can not be resynchronized after a bad header, the connection is dropped.
+				try
+				{
+					connection.Write(std::string{"ERROR "} + e.what() + "\n");
+				}
+				catch (const std::exception &)
+				{}
+			}
+		}
+
+	private:
+		void Serve(Connection &connection)
+		{
+			std::string line;
+			while (connection.ReadLine(line))
+			{
+				std::istringstream request{line};
+				std::string command;
+				std::string day;
+				std::string argument;
+				request >> command >> day >> argument;
+				if (command == "QUIT")
+				{
+					break;
+				}
+
+				// The payload is consumed before anything else can fail so the next header is found again. A
+				// payload that can not be read drops the connection.
+				std::vector<char> payload;
+				if (command == "SOLVE_INLINE")
+				{
+					const auto size = ParseCount(argument);
+					if (size > _options.maxInlineBytes)
+					{
+						throw std::runtime_error("Inline input too large");
+					}
+					payload = connection.ReadExact(size);
+				}
+
+				try
+				{
+					const auto &target = FindDay(day);
+					std::shared_ptr<const InputFile> input;
+					if (command == "SOLVE" && !argument.empty())
+					{
+						input = _inputs.Get(argument);
+					}
+					else if (command == "SOLVE_INLINE")
+					{
+						input = std::make_shared<InputFile>(InputFile::FromBuffer(std::move(payload)));
+						argument = "<inline>";
+					}
+					else
+					{
+						throw std::runtime_error("Invalid request");
+					}
+
+					const auto json = Solve(target, argument, std::move(input));
+					connection.Write("OK " + std::to_string(json.size()) + "\n" + json);
+				}
+				catch (const std::exception &e)
+				{
+					connection.Write(std::string{"ERROR "} + e.what() + "\n");
+				}
+			}
+		}
+
+		std::string Solve(const Day &day, std::string inputName, std::shared_ptr<const InputFile> input)
+		{
+			HarnessOptions options{};
+			options.inputPath = std::move(inputName);
+			options.warmup = _options.warmup;
+			options.iterations = _options.iterations;
+
+			Harness harness{std::string{day.name}, std::move(options)};
+			harness.SetPersistentState(_persistent);
+			harness.UseInput(std::move(input));
+			day.registration(harness);
+			harness.Run();
+
+			std::ostringstream json;
+			harness.WriteJson(json);
+			return json.str();
+		}
+
+	private:
+		ServerOptions _options;
+		std::shared_ptr<PersistentState> _persistent;
+		InputCache _inputs;
+	};
+
+	sockaddr_un SocketAddress(const std::string &path)
+	{
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		if (path.size() >= sizeof(address.sun_path))
+		{
+			throw std::runtime_error("Socket path too long");
+		}
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		return address;
+	}
+
+	// A socket file left behind by a server that is gone is removed, one that still accepts connections
+	// or anything that is not a socket is left alone.
+	void RemoveStaleSocket(const std::string &path, const sockaddr_un &address)
+	{
+		struct stat info{};
+		if (::lstat(path.c_str(), &info) != 0)
+		{
+			return;
+		}
+		if (!S_ISSOCK(info.st_mode))
+		{
+			throw std::runtime_error("Socket path exists and is not a socket");
+		}
+
+		const auto probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (probe < 0)
+		{
+			throw std::runtime_error("Failed to create socket");
+		}
+		const auto connected = ::connect(probe, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+		const auto error = errno;
+		::close(probe);
+		if (connected)
+		{
+			throw std::runtime_error("Socket is in use by another server");
+		}
+		if (error != ECONNREFUSED)
+		{
+			throw std::runtime_error("Failed to probe existing socket");
+		}
+		::unlink(path.c_str());
+	}
+
+	int Listen(const std::string &path)
+	{
+		const auto address = SocketAddress(path);
+		RemoveStaleSocket(path, address);
+
+		const auto fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (fd < 0)
+		{
+			throw std::runtime_error("Failed to create socket");
+		}
+		if (::bind(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 || ::listen(fd, 64) != 0)
+		{
+			::close(fd);
+			throw std::runtime_error("Failed to listen on socket");
+		}
+		return fd;
+	}
+
+	struct Client
+	{
+		int fd;
+		std::atomic<bool> done{false};
+		std::thread thread;
+	};
+
+	// Joins the threads of clients that disconnected and closes their sockets.
+	void Reap(std::list<Client> &clients)
+	{
+		for (auto it = clients.begin(); it != clients.end();)
+		{
+			if (!it->done)
+			{
+				++it;
+				continue;
+			}
+			it->thread.join();
+			::close(it->fd);
+			it = clients.erase(it);
+		}
+	}
+}
+
+// Long running process that keeps inputs and input independent memo tables resident between solve
+// requests, so repeated queries skip process startup and cold caches. Each client gets its own thread,
+// up to --max-clients at a time, further clients are turned away with an error.
+int main(int argc, char **argv)
+{
+	const auto options = ParseServerOptions(argc, argv);
+
+	struct sigaction action{};
+	action.sa_handler = RequestStop;
+	::sigaction(SIGINT, &action, nullptr);
+	::sigaction(SIGTERM, &action, nullptr);
+
+	const auto listener = Listen(options.socketPath);
+	std::cout << "Listening on " << options.socketPath << "\r\n" << std::flush;
+
+	Server server{options};
+	// Only touched by this thread, client threads just raise their done flag.
+	std::list<Client> clients;
+
+	while (stopRequested == 0)
+	{
+		Reap(clients);
+
+		pollfd pending{listener, POLLIN, 0};
+		if (::poll(&pending, 1, 500) <= 0)
+		{
+			continue;
+		}
+
+		const auto fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+		if (fd < 0)
+		{
+			continue;
+		}
+
+		Reap(clients);
+		if (clients.size() >= options.maxClients)
+		{
+			constexpr std::string_view busy = "ERROR Too many connections\n";
+			[[maybe_unused]] const auto sent = ::send(fd, busy.data(), busy.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+			::close(fd);
+			continue;
+		}
+
+		auto &client = clients.emplace_back();
+		client.fd = fd;
+		client.thread = std::thread([&server, &client]
+		                            {
+			                            server.Serve(client.fd);
+			                            client.done = true;
+		                            });
+	}
+
+	// Wakes up clients blocked in recv, requests that are being solved still finish.
+	for (auto &client: clients)
+	{
+		::shutdown(client.fd, SHUT_RDWR);
+	}
+	for (auto &client: clients)
+	{
+		client.thread.join();
+		::close(client.fd);
+	}
+
+	::close(listener);
+	::unlink(options.socketPath.c_str());
+	return 0;
+}
@@ -0,0 +1,173 @@
+#include "AllocationTracker.hpp"
+
+#ifdef AOC_ALLOCATION_TRACKING
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include <malloc.h>
+
+namespace
+{
+	// Trivial type, so using it from inside operator new never needs dynamic thread_local initialization.
+	thread_local AllocationStatistics current{};
+
+	void *Allocate(std::size_t size, std::size_t alignment) noexcept
+	{
+		size = std::max<std::size_t>(size, 1);
+		void *ptr = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__
+				? std::malloc(size)
+				: std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+		if (ptr != nullptr)
+		{
+			++current.allocations;
+			current.bytes += size;
+			current.liveBytes += static_cast<std::int64_t>(malloc_usable_size(ptr));
+			current.peakLiveBytes = std::max(current.peakLiveBytes, current.liveBytes);
+		}
+		return ptr;
+	}
+
+	void *AllocateOrThrow(std::size_t size, std::size_t alignment)
+	{
+		auto *ptr = Allocate(size, alignment);
+		if (ptr == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+
+	void Release(void *ptr) noexcept
+	{
+		if (ptr != nullptr)
+		{
+			++current.deallocations;
+			current.liveBytes -= static_cast<std::int64_t>(malloc_usable_size(ptr));
+			std::free(ptr);
+		}
+	}
+}
+
+AllocationStatistics ThreadAllocations()
+{
+	return current;
+}
+
+void ResetAllocationPeak()
+{
+	current.peakLiveBytes = current.liveBytes;
+}
+
+void *operator new(std::size_t size)
+{
+	return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new[](std::size_t size)
+{
+	return AllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+	return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+	Release(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+	Release(ptr);
+}
+
+#else
+
+AllocationStatistics ThreadAllocations()
+{
+	return {};
+}
+
+void ResetAllocationPeak()
+{}
+
+#endif
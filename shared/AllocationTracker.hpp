@@ -0,0 +1,34 @@
+#ifndef ADVENTOFCODE2021_ALLOCATIONTRACKER_HPP
+#define ADVENTOFCODE2021_ALLOCATIONTRACKER_HPP
+
+#include <cstdint>
+
+// Counts heap allocations made through the global operator new/delete, which are replaced when the build
+// is configured with -DAOC_ALLOCATION_TRACKING=ON. Counters are per thread so a phase only sees its own
+// allocations; memory released by another thread than the one that allocated it shifts the live bytes of
+// both threads. Live and peak bytes are measured with malloc_usable_size, bytes with the requested sizes.
+struct AllocationStatistics
+{
+	std::uint64_t allocations = 0;
+	std::uint64_t deallocations = 0;
+	std::uint64_t bytes = 0;
+	std::int64_t liveBytes = 0;
+	std::int64_t peakLiveBytes = 0;
+};
+
+[[nodiscard]] constexpr bool AllocationTrackingEnabled()
+{
+#ifdef AOC_ALLOCATION_TRACKING
+	return true;
+#else
+	return false;
+#endif
+}
+
+// All zero unless tracking is enabled.
+[[nodiscard]] AllocationStatistics ThreadAllocations();
+
+// Restarts peak tracking of the calling thread at its current live bytes.
+void ResetAllocationPeak();
+
+#endif //ADVENTOFCODE2021_ALLOCATIONTRACKER_HPP
@@ -0,0 +1,156 @@
+#include "ChunkReader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+ChunkReader::ChunkReader(const std::string &path, std::size_t chunkSize)
+		: _chunkSize(std::max<std::size_t>(chunkSize, 1))
+{
+	if (path == "-")
+	{
+		_fd = STDIN_FILENO;
+	}
+	else
+	{
+		_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (_fd < 0)
+		{
+			throw std::runtime_error("Failed to open file");
+		}
+		_ownsFd = true;
+		::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+
+	_wake = ::eventfd(0, EFD_CLOEXEC);
+	if (_wake < 0)
+	{
+		if (_ownsFd)
+		{
+			::close(_fd);
+		}
+		throw std::runtime_error("Failed to create event");
+	}
+
+	for (auto &buffer: _buffers)
+	{
+		buffer.resize(_chunkSize);
+	}
+	_thread = std::thread(&ChunkReader::ReadLoop, this);
+}
+
+ChunkReader::~ChunkReader()
+{
+	{
+		std::lock_guard lock(_mutex);
+		_stop = true;
+	}
+	_changed.notify_all();
+	const std::uint64_t wake = 1;
+	[[maybe_unused]] const auto written = ::write(_wake, &wake, sizeof(wake));
+	_thread.join();
+	::close(_wake);
+
+	if (_ownsFd)
+	{
+		::close(_fd);
+	}
+}
+
+bool ChunkReader::Next(std::string_view &chunk)
+{
+	std::unique_lock lock(_mutex);
+	if (_consuming)
+	{
+		_consuming = false;
+		_next = (_next + 1) % _buffers.size();
+		_changed.notify_all();
+	}
+
+	_changed.wait(lock, [this]
+	{
+		return _ready > 0 || _end;
+	});
+	if (_ready == 0)
+	{
+		if (_error)
+		{
+			std::rethrow_exception(_error);
+		}
+		return false;
+	}
+
+	--_ready;
+	_consuming = true;
+	chunk = {_buffers[_next].data(), _sizes[_next]};
+	_bytesRead += _sizes[_next];
+	return true;
+}
+
+std::size_t ChunkReader::BytesRead() const
+{
+	return _bytesRead;
+}
+
+void ChunkReader::ReadLoop()
+{
+	auto index = 0U;
+	while (true)
+	{
+		{
+			std::unique_lock lock(_mutex);
+			_changed.wait(lock, [this]
+			{
+				return _stop || _ready + (_consuming ? 1 : 0) < _buffers.size();
+			});
+			if (_stop)
+			{
+				return;
+			}
+		}
+
+		// The caller never touches a buffer that is neither ready nor handed out, so it is filled unlocked.
+		// One read per chunk: a pipe hands over what has arrived so far instead of blocking until the
+		// chunk is full, which keeps live input flowing.
+		std::array<pollfd, 2> pending{{{_fd, POLLIN, 0}, {_wake, POLLIN, 0}}};
+		while (::poll(pending.data(), pending.size(), -1) < 0)
+		{
+			if (errno != EINTR)
+			{
+				break;
+			}
+		}
+		if ((pending[1].revents & POLLIN) != 0)
+		{
+			return;
+		}
+
+		auto count = ::read(_fd, _buffers[index].data(), _chunkSize);
+		while (count < 0 && errno == EINTR)
+		{
+			count = ::read(_fd, _buffers[index].data(), _chunkSize);
+		}
+
+		std::lock_guard lock(_mutex);
+		if (count < 0)
+		{
+			_error = std::make_exception_ptr(std::runtime_error("Failed to read file"));
+		}
+		if (count <= 0)
+		{
+			_end = true;
+			_changed.notify_all();
+			return;
+		}
+		_sizes[index] = static_cast<std::size_t>(count);
+		++_ready;
+		_changed.notify_all();
+		index = (index + 1) % _buffers.size();
+	}
+}
@@ -0,0 +1,116 @@
+#ifndef ADVENTOFCODE2021_CHUNKREADER_HPP
+#define ADVENTOFCODE2021_CHUNKREADER_HPP
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Reads a file, or stdin for "-", in chunks of at most chunkSize bytes. A background thread fills one buffer while the
+// caller processes the other, so reading and solving overlap and memory stays at two chunks no matter
+// how large the input is.
+class ChunkReader
+{
+public:
+	static constexpr std::size_t DefaultChunkSize = std::size_t{1} << 20;
+
+	explicit ChunkReader(const std::string &path, std::size_t chunkSize = DefaultChunkSize);
+	~ChunkReader();
+
+	ChunkReader(const ChunkReader &) = delete;
+	ChunkReader &operator=(const ChunkReader &) = delete;
+
+	// The chunk stays valid until the next call. Returns false at the end of the input and rethrows
+	// read errors of the background thread.
+	bool Next(std::string_view &chunk);
+
+	[[nodiscard]] std::size_t BytesRead() const;
+
+private:
+	void ReadLoop();
+
+private:
+	int _fd = -1;
+	bool _ownsFd = false;
+	// Eventfd signalled by the destructor, the background thread polls it next to _fd so a read that
+	// would block on a pipe or terminal is abandoned.
+	int _wake = -1;
+	std::size_t _chunkSize;
+	std::array<std::vector<char>, 2> _buffers;
+	std::array<std::size_t, 2> _sizes{};
+
+	std::mutex _mutex;
+	std::condition_variable _changed;
+	// Filled buffers the caller has not taken yet, and whether it holds one right now.
+	std::size_t _ready = 0;
+	bool _consuming = false;
+	std::size_t _next = 0;
+	bool _end = false;
+	bool _stop = false;
+	std::exception_ptr _error;
+	std::size_t _bytesRead = 0;
+
+	std::thread _thread;
+};
+
+// Calls function(piece, last) for every line, split into pieces that never cross a chunk boundary; last
+// marks the final piece of a line. Folds that can consume a line incrementally never buffer it.
+// Follows std::getline: a trailing newline does not produce an extra empty line.
+template<class Function>
+void ForEachLinePiece(ChunkReader &reader, Function function)
+{
+	auto open = false;
+	std::string_view chunk;
+	while (reader.Next(chunk))
+	{
+		while (!chunk.empty())
+		{
+			const auto newline = chunk.find('\n');
+			if (newline == std::string_view::npos)
+			{
+				function(chunk, false);
+				open = true;
+				break;
+			}
+			function(chunk.substr(0, newline), true);
+			chunk.remove_prefix(newline + 1);
+			open = false;
+		}
+	}
+	if (open)
+	{
+		function(std::string_view{}, true);
+	}
+}
+
+// Calls function(line) for every line. Lines are views into the current chunk, only a line that crosses
+// a chunk boundary is copied together.
+template<class Function>
+void ForEachLine(ChunkReader &reader, Function function)
+{
+	std::string carry;
+	ForEachLinePiece(reader, [&carry, &function](std::string_view piece, bool last)
+	{
+		if (!last)
+		{
+			carry.append(piece);
+		}
+		else if (carry.empty())
+		{
+			function(piece);
+		}
+		else
+		{
+			carry.append(piece);
+			function(std::string_view{carry});
+			carry.clear();
+		}
+	});
+}
+
+#endif //ADVENTOFCODE2021_CHUNKREADER_HPP
@@ -0,0 +1,252 @@
+#ifndef ADVENTOFCODE2021_GRID2D_HPP
+#define ADVENTOFCODE2021_GRID2D_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct GridOffset
+{
+	std::ptrdiff_t dx;
+	std::ptrdiff_t dy;
+};
+
+inline constexpr std::array<GridOffset, 4> Neighbours4{{
+		{0, -1}, {-1, 0}, {1, 0}, {0, 1}
+}};
+
+inline constexpr std::array<GridOffset, 8> Neighbours8{{
+		{-1, -1}, {0, -1}, {1, -1},
+		{-1, 0}, {1, 0},
+		{-1, 1}, {0, 1}, {1, 1}
+}};
+
+// 3x3 block including the centre, in reading order.
+inline constexpr std::array<GridOffset, 9> Square3x3{{
+		{-1, -1}, {0, -1}, {1, -1},
+		{-1, 0}, {0, 0}, {1, 0},
+		{-1, 1}, {0, 1}, {1, 1}
+}};
+
+enum class GridLayout
+{
+	RowMajor,
+	// TileSize x TileSize blocks stored contiguously, vertical neighbours stay on nearby cache lines.
+	Tiled,
+};
+
+// Dense grid surrounded by Border() rings of sentinel cells. Valid coordinates run from -Border() to
+// Width() + Border() - 1, so stencils that reach at most Border() cells out never need a bounds check.
+template<class T, GridLayout Layout = GridLayout::RowMajor>
+class Grid2D
+{
+	static_assert(!std::is_same_v<T, bool>, "std::vector<bool> cells are not addressable, use std::uint8_t");
+
+public:
+	static constexpr std::size_t TileSize = 8;
+
+	Grid2D() = default;
+
+	Grid2D(std::size_t width, std::size_t height, std::size_t border = 0, T value = T{}, T sentinel = T{})
+			: _width(width), _height(height), _border(border),
+			  _stride(Padded(width + 2 * border)), _rows(Padded(height + 2 * border)),
+			  _cells(_stride * _rows, value)
+	{
+		FillBorder(sentinel);
+	}
+
+	[[nodiscard]] std::size_t Width() const
+	{
+		return _width;
+	}
+
+	[[nodiscard]] std::size_t Height() const
+	{
+		return _height;
+	}
+
+	[[nodiscard]] std::size_t Border() const
+	{
+		return _border;
+	}
+
+	[[nodiscard]] std::size_t Index(std::ptrdiff_t x, std::ptrdiff_t y) const
+	{
+		const auto column = static_cast<std::size_t>(x + static_cast<std::ptrdiff_t>(_border));
+		const auto row = static_cast<std::size_t>(y + static_cast<std::ptrdiff_t>(_border));
+		if constexpr (Layout == GridLayout::RowMajor)
+		{
+			return row * _stride + column;
+		}
+		else
+		{
+			const auto tile = (row / TileSize) * (_stride / TileSize) + column / TileSize;
+			return tile * TileSize * TileSize + (row % TileSize) * TileSize + column % TileSize;
+		}
+	}
+
+	T &operator()(std::ptrdiff_t x, std::ptrdiff_t y)
+	{
+		return _cells[Index(x, y)];
+	}
+
+	const T &operator()(std::ptrdiff_t x, std::ptrdiff_t y) const
+	{
+		return _cells[Index(x, y)];
+	}
+
+	T &operator[](std::size_t index)
+	{
+		return _cells[index];
+	}
+
+	const T &operator[](std::size_t index) const
+	{
+		return _cells[index];
+	}
+
+	// Distance between flat indices of a cell and its neighbour, only constant for the row-major layout.
+	[[nodiscard]] std::ptrdiff_t Offset(GridOffset offset) const requires (Layout == GridLayout::RowMajor)
+	{
+		return offset.dy * static_cast<std::ptrdiff_t>(_stride) + offset.dx;
+	}
+
+	template<std::size_t N>
+	[[nodiscard]] std::array<std::ptrdiff_t, N> Offsets(const std::array<GridOffset, N> &stencil) const
+	requires (Layout == GridLayout::RowMajor)
+	{
+		std::array<std::ptrdiff_t, N> result{};
+		for (auto i = 0U; i < N; ++i)
+		{
+			result[i] = Offset(stencil[i]);
+		}
+		return result;
+	}
+
+	// Sets every interior cell, the border is left alone.
+	void Fill(T value)
+	{
+		for (std::ptrdiff_t y = 0; y < static_cast<std::ptrdiff_t>(_height); ++y)
+		{
+			for (std::ptrdiff_t x = 0; x < static_cast<std::ptrdiff_t>(_width); ++x)
+			{
+				(*this)(x, y) = value;
+			}
+		}
+	}
+
+	void FillBorder(T sentinel)
+	{
+		ForEachBorderCell([this, &sentinel](std::ptrdiff_t x, std::ptrdiff_t y)
+		                  {
+			                  (*this)(x, y) = sentinel;
+		                  });
+	}
+
+	// Border cells mirror the opposite edge so stencils see a torus. Requires Border() <= Width(), Height().
+	void WrapBorder()
+	{
+		const auto width = static_cast<std::ptrdiff_t>(_width);
+		const auto height = static_cast<std::ptrdiff_t>(_height);
+		ForEachBorderCell([this, width, height](std::ptrdiff_t x, std::ptrdiff_t y)
+		                  {
+			                  (*this)(x, y) = (*this)((x + width) % width, (y + height) % height);
+		                  });
+	}
+
+	void Swap(Grid2D &other) noexcept
+	{
+		std::swap(_width, other._width);
+		std::swap(_height, other._height);
+		std::swap(_border, other._border);
+		std::swap(_stride, other._stride);
+		std::swap(_rows, other._rows);
+		_cells.swap(other._cells);
+	}
+
+private:
+	static std::size_t Padded(std::size_t size)
+	{
+		if constexpr (Layout == GridLayout::RowMajor)
+		{
+			return size;
+		}
+		else
+		{
+			return (size + TileSize - 1) / TileSize * TileSize;
+		}
+	}
+
+	template<class Function>
+	void ForEachBorderCell(Function function)
+	{
+		const auto border = static_cast<std::ptrdiff_t>(_border);
+		const auto width = static_cast<std::ptrdiff_t>(_width);
+		const auto height = static_cast<std::ptrdiff_t>(_height);
+		for (auto y = -border; y < height + border; ++y)
+		{
+			if (y < 0 || y >= height)
+			{
+				for (auto x = -border; x < width + border; ++x)
+				{
+					function(x, y);
+				}
+				continue;
+			}
+			for (auto x = -border; x < 0; ++x)
+			{
+				function(x, y);
+			}
+			for (auto x = width; x < width + border; ++x)
+			{
+				function(x, y);
+			}
+		}
+	}
+
+private:
+	std::size_t _width = 0;
+	std::size_t _height = 0;
+	std::size_t _border = 0;
+	std::size_t _stride = 0;
+	std::size_t _rows = 0;
+	std::vector<T> _cells;
+};
+
+// Two grids of the same shape for stencil updates: read Current(), write every cell of Next(), then Flip().
+// Flipping swaps the storage, so a simulation allocates both buffers once.
+template<class Grid>
+class DoubleBuffered
+{
+public:
+	explicit DoubleBuffered(Grid grid) : _current(std::move(grid)), _next(_current)
+	{}
+
+	Grid &Current()
+	{
+		return _current;
+	}
+
+	const Grid &Current() const
+	{
+		return _current;
+	}
+
+	Grid &Next()
+	{
+		return _next;
+	}
+
+	void Flip()
+	{
+		_current.Swap(_next);
+	}
+
+private:
+	Grid _current;
+	Grid _next;
+};
+
+#endif //ADVENTOFCODE2021_GRID2D_HPP
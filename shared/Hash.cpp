@@ -0,0 +1,96 @@
+#include "Hash.hpp"
+
+#include <bit>
+#include <cstring>
+
+namespace
+{
+	constexpr std::uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+	constexpr std::uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+	constexpr std::uint64_t Prime3 = 0x165667B19E3779F9ULL;
+	constexpr std::uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+	constexpr std::uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+	std::uint64_t Read64(const char *data)
+	{
+		std::uint64_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::uint32_t Read32(const char *data)
+	{
+		std::uint32_t value;
+		std::memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	std::uint64_t Round(std::uint64_t accumulator, std::uint64_t input)
+	{
+		accumulator += input * Prime2;
+		accumulator = std::rotl(accumulator, 31);
+		return accumulator * Prime1;
+	}
+
+	std::uint64_t MergeRound(std::uint64_t accumulator, std::uint64_t value)
+	{
+		accumulator ^= Round(0, value);
+		return accumulator * Prime1 + Prime4;
+	}
+}
+
+std::uint64_t HashBytes(std::string_view bytes, std::uint64_t seed)
+{
+	const char *cursor = bytes.data();
+	const char *end = bytes.data() + bytes.size();
+
+	std::uint64_t hash;
+	if (bytes.size() >= 32)
+	{
+		std::uint64_t v1 = seed + Prime1 + Prime2;
+		std::uint64_t v2 = seed + Prime2;
+		std::uint64_t v3 = seed;
+		std::uint64_t v4 = seed - Prime1;
+		for (; end - cursor >= 32; cursor += 32)
+		{
+			v1 = Round(v1, Read64(cursor));
+			v2 = Round(v2, Read64(cursor + 8));
+			v3 = Round(v3, Read64(cursor + 16));
+			v4 = Round(v4, Read64(cursor + 24));
+		}
+		hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+		hash = MergeRound(hash, v1);
+		hash = MergeRound(hash, v2);
+		hash = MergeRound(hash, v3);
+		hash = MergeRound(hash, v4);
+	}
+	else
+	{
+		hash = seed + Prime5;
+	}
+	hash += bytes.size();
+
+	for (; end - cursor >= 8; cursor += 8)
+	{
+		hash ^= Round(0, Read64(cursor));
+		hash = std::rotl(hash, 27) * Prime1 + Prime4;
+	}
+	if (end - cursor >= 4)
+	{
+		hash ^= std::uint64_t{Read32(cursor)} * Prime1;
+		hash = std::rotl(hash, 23) * Prime2 + Prime3;
+		cursor += 4;
+	}
+	for (; cursor != end; ++cursor)
+	{
+		hash ^= std::uint64_t{static_cast<unsigned char>(*cursor)} * Prime5;
+		hash = std::rotl(hash, 11) * Prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= Prime2;
+	hash ^= hash >> 29;
+	hash *= Prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
@@ -0,0 +1,10 @@
+#ifndef ADVENTOFCODE2021_HASH_HPP
+#define ADVENTOFCODE2021_HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+
+// XXH64 of a buffer, 32 bytes per round so hashing a whole input costs about as much as reading it.
+[[nodiscard]] std::uint64_t HashBytes(std::string_view bytes, std::uint64_t seed = 0);
+
+#endif //ADVENTOFCODE2021_HASH_HPP
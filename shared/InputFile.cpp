@@ -0,0 +1,344 @@
+#include "InputFile.hpp"
+#include "Parallel.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+	class FileDescriptor
+	{
+	public:
+		explicit FileDescriptor(int fd) : _fd(fd)
+		{}
+
+		~FileDescriptor()
+		{
+			if (_fd >= 0)
+			{
+				::close(_fd);
+			}
+		}
+
+		FileDescriptor(const FileDescriptor &) = delete;
+		FileDescriptor &operator=(const FileDescriptor &) = delete;
+
+		[[nodiscard]] int Get() const
+		{
+			return _fd;
+		}
+
+	private:
+		int _fd;
+	};
+
+	constexpr std::size_t BlockSize = 64;
+	// Below this size splitting is faster than handing chunks to the pool.
+	constexpr std::size_t ParallelSplitThreshold = std::size_t{1} << 20;
+
+	// One bit per newline byte of a BlockSize block.
+	using NewlineFunction = std::uint64_t (*)(const char *block);
+
+	std::uint64_t NewlinesScalar(const char *block)
+	{
+		std::uint64_t mask{};
+		for (auto i = 0U; i < BlockSize; ++i)
+		{
+			if (block[i] == '\n')
+			{
+				mask |= std::uint64_t{1} << i;
+			}
+		}
+		return mask;
+	}
+
+#ifdef AOC_X86_KERNELS
+	__attribute__((target("sse2")))
+	std::uint64_t NewlinesSse2(const char *block)
+	{
+		const auto newline = _mm_set1_epi8('\n');
+
+		std::uint64_t mask{};
+		for (auto i = 0U; i < BlockSize; i += 16)
+		{
+			const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+			mask |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(
+					_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)))) << i;
+		}
+		return mask;
+	}
+
+	__attribute__((target("avx2")))
+	std::uint64_t NewlinesAvx2(const char *block)
+	{
+		const auto newline = _mm256_set1_epi8('\n');
+		const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+		const auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + 32));
+		return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, newline)))) |
+		       (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, newline)))) << 32);
+	}
+#endif
+
+	std::pair<NewlineFunction, std::string_view> SelectNewlineKernel()
+	{
+#ifdef AOC_X86_KERNELS
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {NewlinesAvx2, "avx2"};
+		}
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return {NewlinesSse2, "sse2"};
+		}
+#endif
+		return {NewlinesScalar, "scalar"};
+	}
+
+	const std::pair<NewlineFunction, std::string_view> &Kernel()
+	{
+		static const auto kernel = SelectNewlineKernel();
+		return kernel;
+	}
+
+	std::vector<char> ReadAll(int fd)
+	{
+		constexpr std::size_t ChunkSize = 1 << 16;
+
+		std::vector<char> buffer;
+		std::size_t used = 0;
+		while (true)
+		{
+			buffer.resize(used + ChunkSize);
+			const auto count = ::read(fd, buffer.data() + used, ChunkSize);
+			if (count < 0)
+			{
+				throw std::runtime_error("Failed to read file");
+			}
+			if (count == 0)
+			{
+				break;
+			}
+			used += static_cast<std::size_t>(count);
+		}
+		buffer.resize(used);
+		return buffer;
+	}
+}
+
+InputFile::InputFile(const std::string &path)
+{
+	if (path == "-")
+	{
+		_buffer = ReadAll(STDIN_FILENO);
+		_data = _buffer.data();
+		_size = _buffer.size();
+		return;
+	}
+
+	const FileDescriptor fd{::open(path.c_str(), O_RDONLY)};
+	if (fd.Get() < 0)
+	{
+		throw std::runtime_error("Failed to open file");
+	}
+
+	struct stat info{};
+	if (::fstat(fd.Get(), &info) != 0)
+	{
+		throw std::runtime_error("Failed to open file");
+	}
+
+	if (S_ISREG(info.st_mode) && info.st_size > 0)
+	{
+		const auto size = static_cast<std::size_t>(info.st_size);
+		void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd.Get(), 0);
+		if (mapping != MAP_FAILED)
+		{
+			::madvise(mapping, size, MADV_SEQUENTIAL);
+			::madvise(mapping, size, MADV_WILLNEED);
+			_data = static_cast<const char *>(mapping);
+			_size = size;
+			_mapped = true;
+			return;
+		}
+	}
+
+	_buffer = ReadAll(fd.Get());
+	_data = _buffer.data();
+	_size = _buffer.size();
+}
+
+InputFile::~InputFile()
+{
+	Release();
+}
+
+InputFile::InputFile(InputFile &&other) noexcept
+		: _data(std::exchange(other._data, nullptr)),
+		  _size(std::exchange(other._size, 0)),
+		  _mapped(std::exchange(other._mapped, false)),
+		  _buffer(std::move(other._buffer))
+{
+}
+
+InputFile &InputFile::operator=(InputFile &&other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+		_data = std::exchange(other._data, nullptr);
+		_size = std::exchange(other._size, 0);
+		_mapped = std::exchange(other._mapped, false);
+		_buffer = std::move(other._buffer);
+	}
+	return *this;
+}
+
+InputFile InputFile::FromBuffer(std::vector<char> contents)
+{
+	InputFile input;
+	input._buffer = std::move(contents);
+	input._data = input._buffer.data();
+	input._size = input._buffer.size();
+	return input;
+}
+
+InputFile InputFile::View(std::string_view contents)
+{
+	InputFile input;
+	input._data = contents.data();
+	input._size = contents.size();
+	return input;
+}
+
+void InputFile::Release()
+{
+	if (_mapped)
+	{
+		::munmap(const_cast<char *>(_data), _size);
+	}
+	_data = nullptr;
+	_size = 0;
+	_mapped = false;
+	_buffer.clear();
+}
+
+std::string_view InputFile::Contents() const
+{
+	return {_data, _size};
+}
+
+std::vector<std::string_view> InputFile::Lines() const
+{
+	if (_size >= ParallelSplitThreshold)
+	{
+		return SplitLinesParallel(Contents(), DefaultPool());
+	}
+	return SplitLines(Contents());
+}
+
+bool InputFile::IsMapped() const
+{
+	return _mapped;
+}
+
+std::vector<std::string_view> SplitLines(std::string_view buffer)
+{
+	std::vector<std::string_view> result;
+	result.reserve(buffer.size() / 16);
+
+	const auto newlines = Kernel().first;
+	const char *data = buffer.data();
+	std::size_t lineStart = 0;
+	std::size_t offset = 0;
+	for (; offset + BlockSize <= buffer.size(); offset += BlockSize)
+	{
+		for (auto mask = newlines(data + offset); mask != 0; mask &= mask - 1)
+		{
+			const auto newline = offset + static_cast<std::size_t>(std::countr_zero(mask));
+			result.emplace_back(data + lineStart, newline - lineStart);
+			lineStart = newline + 1;
+		}
+	}
+	for (; offset < buffer.size(); ++offset)
+	{
+		if (data[offset] == '\n')
+		{
+			result.emplace_back(data + lineStart, offset - lineStart);
+			lineStart = offset + 1;
+		}
+	}
+	if (lineStart < buffer.size())
+	{
+		result.emplace_back(data + lineStart, buffer.size() - lineStart);
+	}
+	return result;
+}
+
+std::vector<std::string_view> SplitLinesParallel(std::string_view buffer, ThreadPool &pool)
+{
+	// Chunk boundaries are moved past the next newline, so no line is split between two chunks and
+	// concatenating the chunk indices in order gives the same lines as SplitLines.
+	const auto chunks = pool.Size() <= 1 ? std::size_t{1} : pool.Size() * 4;
+	std::vector<std::size_t> bounds{0};
+	for (auto i = 1U; i < chunks; ++i)
+	{
+		auto bound = std::max(buffer.size() * i / chunks, bounds.back());
+		if (const auto newline = buffer.find('\n', bound); newline != std::string_view::npos)
+		{
+			bound = newline + 1;
+		}
+		else
+		{
+			bound = buffer.size();
+		}
+		bounds.push_back(bound);
+	}
+	bounds.push_back(buffer.size());
+
+	const auto parts = ParallelMap(pool, 0, chunks, 1, [&buffer, &bounds](std::size_t i)
+	{
+		return SplitLines(buffer.substr(bounds[i], bounds[i + 1] - bounds[i]));
+	});
+
+	std::vector<std::size_t> offsets{0};
+	for (const auto &part: parts)
+	{
+		offsets.push_back(offsets.back() + part.size());
+	}
+	std::vector<std::string_view> result(offsets.back());
+	ParallelFor(pool, 0, parts.size(), 1, [&](std::size_t i)
+	{
+		std::copy(parts[i].begin(), parts[i].end(), result.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+	});
+	return result;
+}
+
+std::string_view NewlineKernel()
+{
+	return Kernel().second;
+}
+
+void EvictFromPageCache(const std::string &path)
+{
+	const FileDescriptor fd{::open(path.c_str(), O_RDONLY)};
+	if (fd.Get() < 0)
+	{
+		throw std::runtime_error("Failed to open file");
+	}
+	::fdatasync(fd.Get());
+	::posix_fadvise(fd.Get(), 0, 0, POSIX_FADV_DONTNEED);
+}
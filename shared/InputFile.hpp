@@ -0,0 +1,59 @@
+#ifndef ADVENTOFCODE2021_INPUTFILE_HPP
+#define ADVENTOFCODE2021_INPUTFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ThreadPool;
+
+// Read-only view of a whole input file. Regular files are memory mapped,
+// anything else (pipes, character devices, stdin given as "-") is read into an owned buffer.
+class InputFile
+{
+public:
+	explicit InputFile(const std::string &path);
+	~InputFile();
+
+	InputFile(const InputFile &) = delete;
+	InputFile &operator=(const InputFile &) = delete;
+	InputFile(InputFile &&other) noexcept;
+	InputFile &operator=(InputFile &&other) noexcept;
+
+	// Wraps bytes that did not come from a file, e.g. an input received over a socket.
+	[[nodiscard]] static InputFile FromBuffer(std::vector<char> contents);
+	// Refers to bytes owned by the caller, which must outlive the InputFile. Nothing is copied.
+	[[nodiscard]] static InputFile View(std::string_view contents);
+
+	[[nodiscard]] std::string_view Contents() const;
+	[[nodiscard]] std::vector<std::string_view> Lines() const;
+	[[nodiscard]] bool IsMapped() const;
+
+private:
+	InputFile() = default;
+
+	void Release();
+
+private:
+	const char *_data = nullptr;
+	std::size_t _size = 0;
+	bool _mapped = false;
+	std::vector<char> _buffer;
+};
+
+// Same line semantics as std::getline: a trailing newline does not produce an extra empty line.
+// Newlines are found 64 bytes at a time with the widest SIMD compare the CPU supports.
+[[nodiscard]] std::vector<std::string_view> SplitLines(std::string_view buffer);
+
+// Same lines as SplitLines. The buffer is cut at newlines into a few chunks per worker, which are
+// indexed concurrently on the pool. Lines() switches to it for inputs of a megabyte and more.
+[[nodiscard]] std::vector<std::string_view> SplitLinesParallel(std::string_view buffer, ThreadPool &pool);
+
+// Name of the newline scanning kernel picked for this CPU ("avx2", "sse2" or "scalar").
+[[nodiscard]] std::string_view NewlineKernel();
+
+// Asks the kernel to drop cached pages of the file so the next load is a cold read.
+void EvictFromPageCache(const std::string &path);
+
+#endif //ADVENTOFCODE2021_INPUTFILE_HPP
@@ -0,0 +1,254 @@
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+	template<class T>
+	class Registry
+	{
+	public:
+		T &Get(const std::string &name)
+		{
+			std::lock_guard lock(_mutex);
+			auto &entry = _entries[name];
+			if (!entry)
+			{
+				entry = std::make_unique<T>();
+			}
+			return *entry;
+		}
+
+		template<class Function>
+		void ForEach(Function function)
+		{
+			std::lock_guard lock(_mutex);
+			for (const auto &[name, entry]: _entries)
+			{
+				function(name, *entry);
+			}
+		}
+
+	private:
+		std::mutex _mutex;
+		std::map<std::string, std::unique_ptr<T>> _entries;
+	};
+
+	Registry<instrumentation::Timer> &Timers()
+	{
+		static Registry<instrumentation::Timer> registry;
+		return registry;
+	}
+
+	Registry<instrumentation::Counter> &Counters()
+	{
+		static Registry<instrumentation::Counter> registry;
+		return registry;
+	}
+
+	Registry<instrumentation::Histogram> &Histograms()
+	{
+		static Registry<instrumentation::Histogram> registry;
+		return registry;
+	}
+
+	void UpdateMin(std::atomic<std::uint64_t> &target, std::uint64_t value)
+	{
+		auto current = target.load(std::memory_order_relaxed);
+		while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{}
+	}
+
+	void UpdateMax(std::atomic<std::uint64_t> &target, std::uint64_t value)
+	{
+		auto current = target.load(std::memory_order_relaxed);
+		while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{}
+	}
+}
+
+namespace instrumentation
+{
+	std::uint64_t Timer::Calls() const
+	{
+		return _calls.load(std::memory_order_relaxed);
+	}
+
+	std::chrono::nanoseconds Timer::Total() const
+	{
+		return std::chrono::nanoseconds{_total.load(std::memory_order_relaxed)};
+	}
+
+
+	std::uint64_t Counter::Value() const
+	{
+		return _value.load(std::memory_order_relaxed);
+	}
+
+
+	void Histogram::Record(std::uint64_t value)
+	{
+		_buckets[std::bit_width(value)].fetch_add(1, std::memory_order_relaxed);
+		_count.fetch_add(1, std::memory_order_relaxed);
+		_sum.fetch_add(value, std::memory_order_relaxed);
+		UpdateMin(_min, value);
+		UpdateMax(_max, value);
+	}
+
+	std::uint64_t Histogram::Count() const
+	{
+		return _count.load(std::memory_order_relaxed);
+	}
+
+	std::uint64_t Histogram::Min() const
+	{
+		return Count() == 0 ? 0 : _min.load(std::memory_order_relaxed);
+	}
+
+	std::uint64_t Histogram::Max() const
+	{
+		return _max.load(std::memory_order_relaxed);
+	}
+
+	double Histogram::Mean() const
+	{
+		const auto count = Count();
+		return count == 0 ? 0.0 : static_cast<double>(_sum.load(std::memory_order_relaxed)) / static_cast<double>(count);
+	}
+
+	std::uint64_t Histogram::Percentile(double percentile) const
+	{
+		const auto rank = static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(Count())));
+		std::uint64_t seen = 0;
+		for (auto i = 0U; i < _buckets.size(); ++i)
+		{
+			seen += _buckets[i].load(std::memory_order_relaxed);
+			if (seen >= rank && seen > 0)
+			{
+				const auto upper = i == 0 ? 0 : (i == 64 ? UINT64_MAX : (std::uint64_t{1} << i) - 1);
+				return std::min(upper, Max());
+			}
+		}
+		return Max();
+	}
+
+
+	Timer &GetTimer(const std::string &name)
+	{
+		return Timers().Get(name);
+	}
+
+	Counter &GetCounter(const std::string &name)
+	{
+		return Counters().Get(name);
+	}
+
+	Histogram &GetHistogram(const std::string &name)
+	{
+		return Histograms().Get(name);
+	}
+
+	void WriteReport(std::ostream &os, std::string_view prefix)
+	{
+		constexpr auto NameWidth = 32;
+		constexpr auto ColumnWidth = 14;
+
+		os << std::left << std::setw(NameWidth) << "Timer" << std::right
+		   << std::setw(ColumnWidth) << "calls" << std::setw(ColumnWidth) << "total" << std::setw(ColumnWidth) << "mean"
+		   << "\r\n" << std::fixed << std::setprecision(1);
+		Timers().ForEach([&os, prefix](const std::string &name, const Timer &timer)
+		{
+			if (timer.Calls() == 0 || !name.starts_with(prefix))
+			{
+				return;
+			}
+			const auto total = static_cast<double>(timer.Total().count()) / 1000.0;
+			os << std::left << std::setw(NameWidth) << name << std::right
+			   << std::setw(ColumnWidth) << timer.Calls()
+			   << std::setw(ColumnWidth - 2) << total << "us"
+			   << std::setw(ColumnWidth - 2) << total / static_cast<double>(timer.Calls()) << "us" << "\r\n";
+		});
+
+		os << std::left << std::setw(NameWidth) << "Counter" << std::right << std::setw(ColumnWidth) << "value" << "\r\n";
+		Counters().ForEach([&os, prefix](const std::string &name, const Counter &counter)
+		{
+			if (counter.Value() == 0 || !name.starts_with(prefix))
+			{
+				return;
+			}
+			os << std::left << std::setw(NameWidth) << name << std::right << std::setw(ColumnWidth) << counter.Value() << "\r\n";
+		});
+
+		os << std::left << std::setw(NameWidth) << "Histogram" << std::right
+		   << std::setw(ColumnWidth) << "count" << std::setw(ColumnWidth) << "min" << std::setw(ColumnWidth) << "mean"
+		   << std::setw(ColumnWidth) << "p50<=" << std::setw(ColumnWidth) << "p99<=" << std::setw(ColumnWidth) << "max"
+		   << "\r\n";
+		Histograms().ForEach([&os, prefix](const std::string &name, const Histogram &histogram)
+		{
+			if (histogram.Count() == 0 || !name.starts_with(prefix))
+			{
+				return;
+			}
+			os << std::left << std::setw(NameWidth) << name << std::right
+			   << std::setw(ColumnWidth) << histogram.Count()
+			   << std::setw(ColumnWidth) << histogram.Min()
+			   << std::setw(ColumnWidth) << histogram.Mean()
+			   << std::setw(ColumnWidth) << histogram.Percentile(0.5)
+			   << std::setw(ColumnWidth) << histogram.Percentile(0.99)
+			   << std::setw(ColumnWidth) << histogram.Max() << "\r\n";
+		});
+		os << std::left << std::defaultfloat;
+	}
+
+	void WriteJson(std::ostream &os, std::string_view prefix)
+	{
+		// Names come from string literals in the solvers and never need escaping.
+		auto first = true;
+		const auto separator = [&first]
+		{
+			return std::exchange(first, false) ? "" : ", ";
+		};
+
+		os << "{\"timers\": {";
+		Timers().ForEach([&](const std::string &name, const Timer &timer)
+		{
+			if (timer.Calls() != 0 && name.starts_with(prefix))
+			{
+				os << separator() << "\"" << name << "\": {\"calls\": " << timer.Calls()
+				   << ", \"total_ns\": " << timer.Total().count() << "}";
+			}
+		});
+
+		first = true;
+		os << "}, \"counters\": {";
+		Counters().ForEach([&](const std::string &name, const Counter &counter)
+		{
+			if (counter.Value() != 0 && name.starts_with(prefix))
+			{
+				os << separator() << "\"" << name << "\": " << counter.Value();
+			}
+		});
+
+		first = true;
+		os << "}, \"histograms\": {";
+		Histograms().ForEach([&](const std::string &name, const Histogram &histogram)
+		{
+			if (histogram.Count() != 0 && name.starts_with(prefix))
+			{
+				os << separator() << "\"" << name << "\": {\"count\": " << histogram.Count()
+				   << ", \"min\": " << histogram.Min() << ", \"mean\": " << histogram.Mean()
+				   << ", \"p50\": " << histogram.Percentile(0.5) << ", \"p99\": " << histogram.Percentile(0.99)
+				   << ", \"max\": " << histogram.Max() << "}";
+			}
+		});
+		os << "}}";
+	}
+
+}
@@ -0,0 +1,136 @@
+#ifndef ADVENTOFCODE2021_INSTRUMENTATION_HPP
+#define ADVENTOFCODE2021_INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// Hot path instrumentation: scoped timers, monotonic counters and histograms, registered by name on first
+// use and shared by every thread. Only the AOC_* macros should be used from solver code, they expand to
+// nothing unless the build is configured with -DAOC_INSTRUMENTATION=ON.
+namespace instrumentation
+{
+	class Timer
+	{
+	public:
+		void Add(std::chrono::nanoseconds elapsed)
+		{
+			_calls.fetch_add(1, std::memory_order_relaxed);
+			_total.fetch_add(elapsed.count(), std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] std::uint64_t Calls() const;
+		[[nodiscard]] std::chrono::nanoseconds Total() const;
+
+	private:
+		std::atomic<std::uint64_t> _calls = 0;
+		std::atomic<std::int64_t> _total = 0;
+	};
+
+	class Counter
+	{
+	public:
+		void Add(std::uint64_t value)
+		{
+			_value.fetch_add(value, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] std::uint64_t Value() const;
+
+	private:
+		std::atomic<std::uint64_t> _value = 0;
+	};
+
+	// Keeps one bucket per power of two, bucket i counts the values with std::bit_width(value) == i.
+	class Histogram
+	{
+	public:
+		void Record(std::uint64_t value);
+
+		[[nodiscard]] std::uint64_t Count() const;
+		[[nodiscard]] std::uint64_t Min() const;
+		[[nodiscard]] std::uint64_t Max() const;
+		[[nodiscard]] double Mean() const;
+		// Upper bound of the bucket holding the given percentile.
+		[[nodiscard]] std::uint64_t Percentile(double percentile) const;
+
+	private:
+		std::array<std::atomic<std::uint64_t>, 65> _buckets{};
+		std::atomic<std::uint64_t> _count = 0;
+		std::atomic<std::uint64_t> _sum = 0;
+		std::atomic<std::uint64_t> _min = UINT64_MAX;
+		std::atomic<std::uint64_t> _max = 0;
+	};
+
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(Timer &timer)
+				: _timer(timer), _begin(std::chrono::steady_clock::now())
+		{}
+
+		~ScopedTimer()
+		{
+			_timer.Add(std::chrono::steady_clock::now() - _begin);
+		}
+
+		ScopedTimer(const ScopedTimer &) = delete;
+		ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+	private:
+		Timer &_timer;
+		std::chrono::steady_clock::time_point _begin;
+	};
+
+	// Entries are never removed, so the returned references stay valid for the lifetime of the program.
+	[[nodiscard]] Timer &GetTimer(const std::string &name);
+	[[nodiscard]] Counter &GetCounter(const std::string &name);
+	[[nodiscard]] Histogram &GetHistogram(const std::string &name);
+
+	// Writes the entries whose name starts with prefix and that have been used at least once, sorted by name.
+	void WriteReport(std::ostream &os, std::string_view prefix = {});
+	void WriteJson(std::ostream &os, std::string_view prefix = {});
+
+	[[nodiscard]] constexpr bool Enabled()
+	{
+#ifdef AOC_INSTRUMENTATION
+		return true;
+#else
+		return false;
+#endif
+	}
+}
+
+#define AOC_INSTRUMENTATION_CONCAT_IMPL(a, b) a##b
+#define AOC_INSTRUMENTATION_CONCAT(a, b) AOC_INSTRUMENTATION_CONCAT_IMPL(a, b)
+
+#ifdef AOC_INSTRUMENTATION
+// Times the rest of the enclosing scope.
+#define AOC_SCOPED_TIMER(name) \
+	static auto &AOC_INSTRUMENTATION_CONCAT(aocTimer, __LINE__) = instrumentation::GetTimer(name); \
+	const instrumentation::ScopedTimer AOC_INSTRUMENTATION_CONCAT(aocScopedTimer, __LINE__){AOC_INSTRUMENTATION_CONCAT(aocTimer, __LINE__)}
+#define AOC_COUNTER_ADD(name, value) \
+	do \
+	{ \
+		static auto &aocCounter = instrumentation::GetCounter(name); \
+		aocCounter.Add(value); \
+	} while (false)
+#define AOC_HISTOGRAM_RECORD(name, value) \
+	do \
+	{ \
+		static auto &aocHistogram = instrumentation::GetHistogram(name); \
+		aocHistogram.Record(value); \
+	} while (false)
+#else
+#define AOC_SCOPED_TIMER(name) static_cast<void>(0)
+#define AOC_COUNTER_ADD(name, value) static_cast<void>(0)
+#define AOC_HISTOGRAM_RECORD(name, value) static_cast<void>(0)
+#endif
+
+#define AOC_COUNTER_INCREMENT(name) AOC_COUNTER_ADD(name, 1)
+
+#endif //ADVENTOFCODE2021_INSTRUMENTATION_HPP
@@ -0,0 +1,323 @@
+#include "IntegerList.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	constexpr std::size_t BlockSize = 64;
+	constexpr std::size_t SwarSlack = 8;
+
+	struct BlockMasks
+	{
+		std::uint64_t digits;
+		std::uint64_t invalid;
+	};
+
+	using ClassifyFunction = BlockMasks (*)(const char *block);
+
+	bool IsSeparator(char c)
+	{
+		return c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+	}
+
+	BlockMasks ClassifyScalar(const char *block)
+	{
+		BlockMasks masks{};
+		for (auto i = 0U; i < BlockSize; ++i)
+		{
+			const auto c = block[i];
+			if (c >= '0' && c <= '9')
+			{
+				masks.digits |= std::uint64_t{1} << i;
+			}
+			else if (!IsSeparator(c))
+			{
+				masks.invalid |= std::uint64_t{1} << i;
+			}
+		}
+		return masks;
+	}
+
+#ifdef AOC_X86_KERNELS
+	__attribute__((target("sse4.2")))
+	BlockMasks ClassifySse42(const char *block)
+	{
+		const auto zero = _mm_set1_epi8('0');
+		const auto nine = _mm_set1_epi8(9);
+		const auto separators = _mm_setr_epi8(',', ' ', '\n', '\r', '\t', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+		BlockMasks masks{};
+		for (auto i = 0U; i < BlockSize; i += 16)
+		{
+			const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+			const auto offset = _mm_sub_epi8(bytes, zero);
+			const auto digits = _mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset);
+			const auto separator = _mm_cmpestrm(separators, 5, bytes, 16,
+			                                    _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_UNIT_MASK);
+			const auto valid = _mm_or_si128(digits, separator);
+
+			masks.digits |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(digits))) << i;
+			masks.invalid |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(~_mm_movemask_epi8(valid))) << i;
+		}
+		return masks;
+	}
+
+	__attribute__((target("avx2")))
+	BlockMasks ClassifyAvx2(const char *block)
+	{
+		const auto zero = _mm256_set1_epi8('0');
+		const auto nine = _mm256_set1_epi8(9);
+
+		BlockMasks masks{};
+		for (auto i = 0U; i < BlockSize; i += 32)
+		{
+			const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + i));
+			const auto offset = _mm256_sub_epi8(bytes, zero);
+			const auto digits = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, nine), offset);
+
+			auto separator = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(','));
+			separator = _mm256_or_si256(separator, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')));
+			separator = _mm256_or_si256(separator, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+			separator = _mm256_or_si256(separator, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r')));
+			separator = _mm256_or_si256(separator, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t')));
+			const auto valid = _mm256_or_si256(digits, separator);
+
+			masks.digits |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(digits))) << i;
+			masks.invalid |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(~_mm256_movemask_epi8(valid))) << i;
+		}
+		return masks;
+	}
+#endif
+
+	std::pair<ClassifyFunction, std::string_view> SelectKernel()
+	{
+#ifdef AOC_X86_KERNELS
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {ClassifyAvx2, "avx2"};
+		}
+		if (__builtin_cpu_supports("sse4.2"))
+		{
+			return {ClassifySse42, "sse4.2"};
+		}
+#endif
+		return {ClassifyScalar, "scalar"};
+	}
+
+	const std::pair<ClassifyFunction, std::string_view> &Kernel()
+	{
+		static const auto kernel = SelectKernel();
+		return kernel;
+	}
+
+	// Converts up to 8 ASCII digits at once. Reads 8 bytes starting at digits, only the first count are used.
+	std::uint64_t ParseDigitsSwar(const char *digits, std::size_t count)
+	{
+		std::uint64_t value;
+		std::memcpy(&value, digits, sizeof(value));
+		value -= 0x3030303030303030ULL;
+		value <<= (8 - count) * 8;
+		value = (value * 10) + (value >> 8);
+		value = (((value & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+		         (((value >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+		return value;
+	}
+
+	template<class N>
+	class ListBuilder
+	{
+	public:
+		explicit ListBuilder(std::size_t sizeHint)
+		{
+			_result.reserve(sizeHint);
+		}
+
+		// Consumes the first length bytes of a block, digits holds one bit per digit byte.
+		// At least 8 readable bytes must follow every position inside the block.
+		void Consume(const char *block, std::uint64_t digits, std::size_t length)
+		{
+			if (_inNumber)
+			{
+				const auto run = std::min<std::size_t>(std::countr_one(digits), length);
+				Accumulate(block, 0, run);
+				if (run == length)
+				{
+					return;
+				}
+				Push(_value);
+				digits &= ~((std::uint64_t{1} << run) - 1);
+			}
+
+			const bool carryOut = ((digits >> (length - 1)) & 1) != 0;
+			auto starts = digits & ~(digits << 1);
+			auto ends = digits & ~(digits >> 1);
+			while (starts != 0)
+			{
+				const auto first = static_cast<std::size_t>(std::countr_zero(starts));
+				const auto last = static_cast<std::size_t>(std::countr_zero(ends));
+				starts &= starts - 1;
+				ends &= ends - 1;
+
+				const auto run = last - first + 1;
+				if (starts == 0 && carryOut)
+				{
+					// The number may continue in the next block.
+					_inNumber = true;
+					Accumulate(block, first, last + 1);
+				}
+				else if (run <= 8)
+				{
+					Push(ParseDigitsSwar(block + first, run));
+				}
+				else
+				{
+					Accumulate(block, first, last + 1);
+					Push(_value);
+				}
+			}
+		}
+
+		std::vector<N> Finish()
+		{
+			if (_inNumber)
+			{
+				Push(_value);
+			}
+			return std::move(_result);
+		}
+
+	private:
+		void Accumulate(const char *block, std::size_t begin, std::size_t end)
+		{
+			for (auto i = begin; i < end; ++i)
+			{
+				_value = _value * 10 + static_cast<std::uint64_t>(block[i] - '0');
+			}
+			_digits += end - begin;
+			if (_digits > std::numeric_limits<std::uint64_t>::digits10)
+			{
+				throw std::runtime_error("Failed to parse input");
+			}
+		}
+
+		void Push(std::uint64_t value)
+		{
+			if (value > std::numeric_limits<N>::max())
+			{
+				throw std::runtime_error("Failed to parse input");
+			}
+			_result.push_back(static_cast<N>(value));
+			_value = 0;
+			_digits = 0;
+			_inNumber = false;
+		}
+
+	private:
+		std::vector<N> _result;
+		std::uint64_t _value = 0;
+		std::size_t _digits = 0;
+		bool _inNumber = false;
+	};
+}
+
+template<class N>
+std::vector<N> ParseIntegerList(std::string_view buffer)
+{
+	static_assert(std::is_unsigned_v<N>);
+
+	const auto classify = Kernel().first;
+	ListBuilder<N> builder{buffer.size() / 2 + 1};
+
+	// Full blocks are only taken while the SWAR conversion can safely read past their end.
+	std::size_t offset = 0;
+	for (; offset + BlockSize + SwarSlack <= buffer.size(); offset += BlockSize)
+	{
+		const auto masks = classify(buffer.data() + offset);
+		if (masks.invalid != 0)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		builder.Consume(buffer.data() + offset, masks.digits, BlockSize);
+	}
+
+	// Copy the tail into a buffer padded with separators so it can go through the same kernel.
+	char tail[2 * BlockSize + SwarSlack];
+	std::memset(tail, ' ', sizeof(tail));
+	std::memcpy(tail, buffer.data() + offset, buffer.size() - offset);
+	for (std::size_t tailOffset = 0; offset + tailOffset < buffer.size(); tailOffset += BlockSize)
+	{
+		const auto masks = classify(tail + tailOffset);
+		if (masks.invalid != 0)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		builder.Consume(tail + tailOffset, masks.digits, std::min(BlockSize, buffer.size() - offset - tailOffset));
+	}
+
+	return builder.Finish();
+}
+
+template<class N>
+std::vector<N> ParseIntegerListParallel(std::string_view buffer, ThreadPool &pool)
+{
+	// Chunk boundaries are moved past the next separator, so no number is split between two chunks.
+	const auto chunks = pool.Size() <= 1 ? std::size_t{1} : pool.Size() * 4;
+	std::vector<std::size_t> bounds{0};
+	for (auto i = 1U; i < chunks; ++i)
+	{
+		auto bound = std::max(buffer.size() * i / chunks, bounds.back());
+		if (const auto separator = buffer.find_first_of(", \n\r\t", bound); separator != std::string_view::npos)
+		{
+			bound = separator + 1;
+		}
+		else
+		{
+			bound = buffer.size();
+		}
+		bounds.push_back(bound);
+	}
+	bounds.push_back(buffer.size());
+
+	const auto parts = ParallelMap(pool, 0, chunks, 1, [&buffer, &bounds](std::size_t i)
+	{
+		return ParseIntegerList<N>(buffer.substr(bounds[i], bounds[i + 1] - bounds[i]));
+	});
+
+	std::vector<std::size_t> offsets{0};
+	for (const auto &part: parts)
+	{
+		offsets.push_back(offsets.back() + part.size());
+	}
+	std::vector<N> result(offsets.back());
+	ParallelFor(pool, 0, parts.size(), 1, [&](std::size_t i)
+	{
+		std::copy(parts[i].begin(), parts[i].end(), result.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+	});
+	return result;
+}
+
+std::string_view IntegerListKernel()
+{
+	return Kernel().second;
+}
+
+template std::vector<std::uint8_t> ParseIntegerList<std::uint8_t>(std::string_view buffer);
+template std::vector<std::uint16_t> ParseIntegerList<std::uint16_t>(std::string_view buffer);
+template std::vector<std::uint32_t> ParseIntegerList<std::uint32_t>(std::string_view buffer);
+template std::vector<std::uint64_t> ParseIntegerList<std::uint64_t>(std::string_view buffer);
+template std::vector<std::uint8_t> ParseIntegerListParallel<std::uint8_t>(std::string_view buffer, ThreadPool &pool);
+template std::vector<std::uint16_t> ParseIntegerListParallel<std::uint16_t>(std::string_view buffer, ThreadPool &pool);
+template std::vector<std::uint32_t> ParseIntegerListParallel<std::uint32_t>(std::string_view buffer, ThreadPool &pool);
+template std::vector<std::uint64_t> ParseIntegerListParallel<std::uint64_t>(std::string_view buffer, ThreadPool &pool);
@@ -0,0 +1,32 @@
+#ifndef ADVENTOFCODE2021_INTEGERLIST_HPP
+#define ADVENTOFCODE2021_INTEGERLIST_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class ThreadPool;
+
+// Parses a whole buffer of unsigned decimal integers separated by commas and/or whitespace in a single pass.
+// Bytes are classified 64 at a time with AVX2 or SSE4.2 when the CPU supports it, with a scalar fallback.
+template<class N>
+[[nodiscard]] std::vector<N> ParseIntegerList(std::string_view buffer);
+
+// Same integers as ParseIntegerList. The buffer is cut after separators into a few chunks per worker, which are
+// parsed concurrently on the pool.
+template<class N>
+[[nodiscard]] std::vector<N> ParseIntegerListParallel(std::string_view buffer, ThreadPool &pool);
+
+// Name of the classification kernel picked for this CPU ("avx2", "sse4.2" or "scalar").
+[[nodiscard]] std::string_view IntegerListKernel();
+
+extern template std::vector<std::uint8_t> ParseIntegerList<std::uint8_t>(std::string_view buffer);
+extern template std::vector<std::uint16_t> ParseIntegerList<std::uint16_t>(std::string_view buffer);
+extern template std::vector<std::uint32_t> ParseIntegerList<std::uint32_t>(std::string_view buffer);
+extern template std::vector<std::uint64_t> ParseIntegerList<std::uint64_t>(std::string_view buffer);
+extern template std::vector<std::uint8_t> ParseIntegerListParallel<std::uint8_t>(std::string_view buffer, ThreadPool &pool);
+extern template std::vector<std::uint16_t> ParseIntegerListParallel<std::uint16_t>(std::string_view buffer, ThreadPool &pool);
+extern template std::vector<std::uint32_t> ParseIntegerListParallel<std::uint32_t>(std::string_view buffer, ThreadPool &pool);
+extern template std::vector<std::uint64_t> ParseIntegerListParallel<std::uint64_t>(std::string_view buffer, ThreadPool &pool);
+
+#endif //ADVENTOFCODE2021_INTEGERLIST_HPP
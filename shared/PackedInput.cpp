@@ -0,0 +1,241 @@
+#include "PackedInput.hpp"
+
+#include <bit>
+#include <cstring>
+
+namespace
+{
+	static_assert(std::endian::native == std::endian::little, "Packed inputs are read in place as little endian");
+
+	constexpr std::string_view Magic{"AOCPACK\0", 8};
+	constexpr std::size_t Alignment = 64;
+
+	struct Header
+	{
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t day;
+		std::uint32_t sectionCount;
+		std::uint32_t reserved;
+	};
+
+	std::size_t Aligned(std::size_t offset)
+	{
+		return (offset + Alignment - 1) / Alignment * Alignment;
+	}
+
+	std::uint64_t PackedBytes(std::uint32_t type, std::uint64_t count)
+	{
+		switch (static_cast<PackedType>(type))
+		{
+			case PackedType::U8:
+				return count;
+			case PackedType::U16:
+				return count * 2;
+			case PackedType::U32:
+			case PackedType::I32:
+				return count * 4;
+			case PackedType::I64:
+				return count * 8;
+			case PackedType::Nibbles:
+				return (count + 1) / 2;
+			case PackedType::Bits:
+				return (count + 7) / 8;
+		}
+		throw std::runtime_error("Unknown packed column type");
+	}
+}
+
+bool IsPackedInput(std::string_view contents)
+{
+	return contents.starts_with(Magic);
+}
+
+PackedWriter::PackedWriter(std::uint32_t day) : _day(day)
+{}
+
+void PackedWriter::AddNibbles(std::span<const std::uint8_t> values)
+{
+	std::string bytes((values.size() + 1) / 2, '\0');
+	for (auto i = 0U; i < values.size(); ++i)
+	{
+		if (values[i] >= 16)
+		{
+			throw std::runtime_error("Value does not fit into a nibble");
+		}
+		bytes[i / 2] = static_cast<char>(bytes[i / 2] | values[i] << (i % 2 * 4));
+	}
+	AddSection(PackedType::Nibbles, values.size(), bytes);
+}
+
+void PackedWriter::AddBits(std::span<const std::uint8_t> values)
+{
+	std::string bytes((values.size() + 7) / 8, '\0');
+	for (auto i = 0U; i < values.size(); ++i)
+	{
+		if (values[i] != 0)
+		{
+			bytes[i / 8] = static_cast<char>(bytes[i / 8] | 1 << (i % 8));
+		}
+	}
+	AddSection(PackedType::Bits, values.size(), bytes);
+}
+
+void PackedWriter::AddString(std::string_view value)
+{
+	AddSection(PackedType::U8, value.size(), value);
+}
+
+void PackedWriter::AddSection(PackedType type, std::uint64_t count, std::string_view bytes)
+{
+	_sections.push_back({type, count, std::string{bytes}});
+}
+
+std::string PackedWriter::Finish() const
+{
+	Header header{};
+	std::memcpy(header.magic, Magic.data(), Magic.size());
+	header.version = PackedVersion;
+	header.day = _day;
+	header.sectionCount = static_cast<std::uint32_t>(_sections.size());
+
+	std::vector<PackedSection> table;
+	auto offset = Aligned(sizeof(Header) + _sections.size() * sizeof(PackedSection));
+	for (const auto &section: _sections)
+	{
+		table.push_back({static_cast<std::uint32_t>(section.type), 0, section.count, offset, section.bytes.size()});
+		offset = Aligned(offset + section.bytes.size());
+	}
+
+	std::string result(offset, '\0');
+	std::memcpy(result.data(), &header, sizeof(header));
+	std::memcpy(result.data() + sizeof(header), table.data(), table.size() * sizeof(PackedSection));
+	for (auto i = 0U; i < _sections.size(); ++i)
+	{
+		std::memcpy(result.data() + table[i].offset, _sections[i].bytes.data(), _sections[i].bytes.size());
+	}
+	return result;
+}
+
+PackedReader::PackedReader(std::string_view contents, std::uint32_t day) : _contents(contents)
+{
+	Header header{};
+	if (contents.size() < sizeof(header) || !IsPackedInput(contents))
+	{
+		throw std::runtime_error("Not a packed input");
+	}
+	if (reinterpret_cast<std::uintptr_t>(contents.data()) % alignof(std::uint64_t) != 0)
+	{
+		throw std::runtime_error("Packed input is not aligned");
+	}
+	std::memcpy(&header, contents.data(), sizeof(header));
+	if (header.version != PackedVersion)
+	{
+		throw std::runtime_error("Unsupported packed input version");
+	}
+	if (header.day != day)
+	{
+		throw std::runtime_error("Packed input belongs to another day");
+	}
+	if ((contents.size() - sizeof(header)) / sizeof(PackedSection) < header.sectionCount)
+	{
+		throw std::runtime_error("Truncated packed input");
+	}
+	_sectionCount = header.sectionCount;
+
+	// Checked once here, the accessors trust the table afterwards. No column stores more than eight values
+	// per byte of the input, bounding the count first keeps PackedBytes from overflowing.
+	for (auto i = 0U; i < _sectionCount; ++i)
+	{
+		const auto &section = At(i);
+		if (section.count / 8 > contents.size() || section.offset % Alignment != 0 ||
+		    section.offset > contents.size() || section.bytes > contents.size() - section.offset ||
+		    section.bytes != PackedBytes(section.type, section.count))
+		{
+			throw std::runtime_error("Corrupt packed input");
+		}
+	}
+}
+
+std::size_t PackedReader::SectionCount() const
+{
+	return _sectionCount;
+}
+
+std::size_t PackedReader::Count(std::size_t section) const
+{
+	return At(section).count;
+}
+
+std::vector<std::uint8_t> PackedReader::Nibbles(std::size_t section) const
+{
+	const auto bytes = Bytes(section, PackedType::Nibbles);
+	std::vector<std::uint8_t> result(Count(section));
+	for (auto i = 0U; i < result.size(); ++i)
+	{
+		result[i] = static_cast<std::uint8_t>(bytes[i / 2]) >> (i % 2 * 4) & 0xf;
+	}
+	return result;
+}
+
+std::vector<std::uint8_t> PackedReader::Bits(std::size_t section) const
+{
+	const auto bytes = Bytes(section, PackedType::Bits);
+	std::vector<std::uint8_t> result(Count(section));
+	for (auto i = 0U; i < result.size(); ++i)
+	{
+		result[i] = static_cast<std::uint8_t>(bytes[i / 8]) >> (i % 8) & 1;
+	}
+	return result;
+}
+
+std::string_view PackedReader::String(std::size_t section) const
+{
+	return Bytes(section, PackedType::U8);
+}
+
+const PackedSection &PackedReader::At(std::size_t section) const
+{
+	if (section >= _sectionCount)
+	{
+		throw std::runtime_error("Missing packed input column");
+	}
+	// The table follows the 24 byte header, so its entries are 8 byte aligned in a mapped file.
+	return reinterpret_cast<const PackedSection *>(_contents.data() + sizeof(Header))[section];
+}
+
+std::string_view PackedReader::Bytes(std::size_t section, PackedType type) const
+{
+	const auto &entry = At(section);
+	if (entry.type != static_cast<std::uint32_t>(type))
+	{
+		throw std::runtime_error("Unexpected packed input column type");
+	}
+	return _contents.substr(entry.offset, entry.bytes);
+}
+
+void AddDigitGrid(PackedWriter &writer, const std::vector<std::string_view> &lines)
+{
+	const auto width = lines.front().size();
+	std::vector<std::uint8_t> cells;
+	cells.reserve(width * lines.size());
+	for (const auto &line: lines)
+	{
+		if (line.size() != width)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		for (const auto c: line)
+		{
+			if (c < '0' || c > '9')
+			{
+				throw std::runtime_error("Failed to parse input");
+			}
+			cells.push_back(static_cast<std::uint8_t>(c - '0'));
+		}
+	}
+
+	const std::array<std::uint32_t, 2> shape{static_cast<std::uint32_t>(width), static_cast<std::uint32_t>(lines.size())};
+	writer.AddArray<std::uint32_t>(shape);
+	writer.AddNibbles(cells);
+}
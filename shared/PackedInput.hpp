@@ -0,0 +1,178 @@
+#ifndef ADVENTOFCODE2021_PACKEDINPUT_HPP
+#define ADVENTOFCODE2021_PACKEDINPUT_HPP
+
+#include "Grid2D.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Binary input format written by aoc_pack, a pre-parsed input of one day as a list of typed columns.
+// Little endian, laid out so a memory mapped file is read in place:
+//   header    "AOCPACK\0", u32 version, u32 day, u32 section count, u32 zero
+//   sections  per column u32 type, u32 zero, u64 element count, u64 byte offset, u64 byte size
+//   data      every column starts on a 64 byte boundary
+// What the columns mean is up to the day, see its Pack function.
+inline constexpr std::uint32_t PackedVersion = 1;
+
+enum class PackedType : std::uint32_t
+{
+	U8 = 1,
+	U16,
+	U32,
+	I32,
+	I64,
+	// Two values below 16 per byte, low nibble first.
+	Nibbles,
+	// Eight flags per byte, lowest bit first.
+	Bits,
+};
+
+template<class T>
+constexpr PackedType PackedTypeOf()
+{
+	if constexpr (std::is_same_v<T, std::uint8_t>)
+	{
+		return PackedType::U8;
+	}
+	else if constexpr (std::is_same_v<T, std::uint16_t>)
+	{
+		return PackedType::U16;
+	}
+	else if constexpr (std::is_same_v<T, std::uint32_t>)
+	{
+		return PackedType::U32;
+	}
+	else if constexpr (std::is_same_v<T, std::int32_t>)
+	{
+		return PackedType::I32;
+	}
+	else
+	{
+		static_assert(std::is_same_v<T, std::int64_t>, "Unsupported packed column type");
+		return PackedType::I64;
+	}
+}
+
+// Entry of the section table.
+struct PackedSection
+{
+	std::uint32_t type;
+	std::uint32_t reserved;
+	std::uint64_t count;
+	std::uint64_t offset;
+	std::uint64_t bytes;
+};
+
+// True if the buffer starts with the packed magic, text inputs never do.
+[[nodiscard]] bool IsPackedInput(std::string_view contents);
+
+class PackedWriter
+{
+public:
+	explicit PackedWriter(std::uint32_t day);
+
+	template<class T>
+	void AddArray(std::span<const T> values)
+	{
+		AddSection(PackedTypeOf<T>(), values.size(), {reinterpret_cast<const char *>(values.data()), values.size_bytes()});
+	}
+
+	// Every value must be below 16.
+	void AddNibbles(std::span<const std::uint8_t> values);
+	// Non-zero values are stored as set bits.
+	void AddBits(std::span<const std::uint8_t> values);
+	void AddString(std::string_view value);
+
+	[[nodiscard]] std::string Finish() const;
+
+private:
+	struct Section
+	{
+		PackedType type;
+		std::uint64_t count;
+		std::string bytes;
+	};
+
+	void AddSection(PackedType type, std::uint64_t count, std::string_view bytes);
+
+private:
+	std::uint32_t _day;
+	std::vector<Section> _sections;
+};
+
+// Validated view of a packed buffer, the columns point into it. Throws if the buffer is not a packed
+// input of this version and day.
+class PackedReader
+{
+public:
+	PackedReader(std::string_view contents, std::uint32_t day);
+
+	[[nodiscard]] std::size_t SectionCount() const;
+	[[nodiscard]] std::size_t Count(std::size_t section) const;
+
+	template<class T>
+	[[nodiscard]] std::span<const T> Array(std::size_t section) const
+	{
+		const auto bytes = Bytes(section, PackedTypeOf<T>());
+		return {reinterpret_cast<const T *>(bytes.data()), Count(section)};
+	}
+
+	[[nodiscard]] std::vector<std::uint8_t> Nibbles(std::size_t section) const;
+	[[nodiscard]] std::vector<std::uint8_t> Bits(std::size_t section) const;
+	[[nodiscard]] std::string_view String(std::size_t section) const;
+	// Undecoded bytes of a column, throws if it has another type.
+	[[nodiscard]] std::string_view Bytes(std::size_t section, PackedType type) const;
+
+private:
+	[[nodiscard]] const PackedSection &At(std::size_t section) const;
+
+private:
+	std::string_view _contents;
+	std::uint32_t _sectionCount = 0;
+};
+
+// Single digit grids (days 9, 11 and 15) as a {width, height} U32 column followed by a nibble column.
+void AddDigitGrid(PackedWriter &writer, const std::vector<std::string_view> &lines);
+
+template<class T>
+Grid2D<T> ReadDigitGrid(const PackedReader &reader, std::size_t section, std::size_t border, T sentinel = T{})
+{
+	const auto shape = reader.Array<std::uint32_t>(section);
+	if (shape.size() != 2 || reader.Count(section + 1) != std::size_t{shape[0]} * shape[1])
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+
+	// Decoded straight into the grid rows two cells per byte, this is the whole parse of a packed grid.
+	const auto *cells = reinterpret_cast<const std::uint8_t *>(reader.Bytes(section + 1, PackedType::Nibbles).data());
+	Grid2D<T> grid{shape[0], shape[1], border, T{}, sentinel};
+	std::size_t cell = 0;
+	for (std::ptrdiff_t y = 0; y < shape[1]; ++y, cell += shape[0])
+	{
+		auto *row = &grid[grid.Index(0, y)];
+		std::size_t x = 0;
+		if (cell % 2 == 1 && shape[0] > 0)
+		{
+			row[x++] = static_cast<T>(cells[cell / 2] >> 4);
+		}
+		const auto *bytes = cells + (cell + x) / 2;
+		for (; x + 1 < shape[0]; x += 2, ++bytes)
+		{
+			row[x] = static_cast<T>(*bytes & 0xf);
+			row[x + 1] = static_cast<T>(*bytes >> 4);
+		}
+		if (x < shape[0])
+		{
+			row[x] = static_cast<T>(*bytes & 0xf);
+		}
+	}
+	return grid;
+}
+
+#endif //ADVENTOFCODE2021_PACKEDINPUT_HPP
@@ -0,0 +1,176 @@
+#ifndef ADVENTOFCODE2021_PARALLEL_HPP
+#define ADVENTOFCODE2021_PARALLEL_HPP
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace parallel_detail
+{
+	// A few chunks per worker so stealing can even out chunks of unequal cost. A single worker would only
+	// time slice with the calling thread, so its loops run serially on the caller.
+	inline std::size_t ChunkCount(const ThreadPool &pool, std::size_t count, std::size_t grain)
+	{
+		if (pool.Size() <= 1)
+		{
+			return 1;
+		}
+		grain = std::max<std::size_t>(grain, 1);
+		return std::min((count + grain - 1) / grain, pool.Size() * 4);
+	}
+
+	// Runs chunk(first, last) for every chunk of [begin, end), chunk number 0 on the calling thread.
+	template<class Chunk>
+	void ForEachChunk(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t chunks, Chunk chunk)
+	{
+		const auto count = end - begin;
+		const auto bounds = [&](std::size_t index)
+		{
+			return begin + count * index / chunks;
+		};
+
+		TaskGroup group{pool};
+		for (auto index = 1U; index < chunks; ++index)
+		{
+			group.Run([&chunk, &bounds, index]
+			          {
+				          chunk(index, bounds(index), bounds(index + 1));
+			          });
+		}
+		chunk(0, bounds(0), bounds(1));
+		group.Wait();
+	}
+}
+
+// Calls body(i) for every i in [begin, end). Indices are split into contiguous chunks of at least grain
+// indices, small ranges run on the calling thread.
+template<class Body>
+void ParallelFor(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t grain, Body body)
+{
+	if (end <= begin)
+	{
+		return;
+	}
+	const auto chunks = parallel_detail::ChunkCount(pool, end - begin, grain);
+	if (chunks <= 1)
+	{
+		for (auto i = begin; i < end; ++i)
+		{
+			body(i);
+		}
+		return;
+	}
+
+	parallel_detail::ForEachChunk(pool, begin, end, chunks, [&body](std::size_t, std::size_t first, std::size_t last)
+	{
+		for (auto i = first; i < last; ++i)
+		{
+			body(i);
+		}
+	});
+}
+
+template<class Body>
+void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body body)
+{
+	ParallelFor(DefaultPool(), begin, end, grain, std::move(body));
+}
+
+// Folds map(i) over [begin, end) with combine, starting every chunk from identity. Chunk results are
+// combined in index order, so combine only needs to be associative.
+template<class T, class Map, class Combine>
+T ParallelReduce(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t grain, T identity, Map map,
+                 Combine combine)
+{
+	const auto fold = [&](T value, std::size_t first, std::size_t last)
+	{
+		for (auto i = first; i < last; ++i)
+		{
+			value = combine(std::move(value), map(i));
+		}
+		return value;
+	};
+
+	if (end <= begin)
+	{
+		return identity;
+	}
+	const auto chunks = parallel_detail::ChunkCount(pool, end - begin, grain);
+	if (chunks <= 1)
+	{
+		return fold(std::move(identity), begin, end);
+	}
+
+	std::vector<T> partials(chunks, identity);
+	parallel_detail::ForEachChunk(pool, begin, end, chunks, [&](std::size_t index, std::size_t first, std::size_t last)
+	{
+		partials[index] = fold(identity, first, last);
+	});
+
+	auto result = std::move(identity);
+	for (auto &partial: partials)
+	{
+		result = combine(std::move(result), std::move(partial));
+	}
+	return result;
+}
+
+template<class T, class Map, class Combine>
+T ParallelReduce(std::size_t begin, std::size_t end, std::size_t grain, T identity, Map map, Combine combine)
+{
+	return ParallelReduce(DefaultPool(), begin, end, grain, std::move(identity), std::move(map), std::move(combine));
+}
+
+// Returns function(i) for every i in [begin, end) in index order. Every chunk fills its own vector and
+// the vectors are concatenated, so the values need no default constructor.
+template<class Function>
+auto ParallelMap(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t grain, Function function)
+{
+	using Value = std::decay_t<std::invoke_result_t<Function &, std::size_t>>;
+
+	std::vector<Value> result;
+	if (end <= begin)
+	{
+		return result;
+	}
+	const auto chunks = parallel_detail::ChunkCount(pool, end - begin, grain);
+	if (chunks <= 1)
+	{
+		result.reserve(end - begin);
+		for (auto i = begin; i < end; ++i)
+		{
+			result.push_back(function(i));
+		}
+		return result;
+	}
+
+	std::vector<std::vector<Value>> parts(chunks);
+	parallel_detail::ForEachChunk(pool, begin, end, chunks, [&](std::size_t index, std::size_t first, std::size_t last)
+	{
+		parts[index].reserve(last - first);
+		for (auto i = first; i < last; ++i)
+		{
+			parts[index].push_back(function(i));
+		}
+	});
+
+	result.reserve(end - begin);
+	for (auto &part: parts)
+	{
+		result.insert(result.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+	}
+	return result;
+}
+
+template<class Function>
+auto ParallelMap(std::size_t begin, std::size_t end, std::size_t grain, Function function)
+{
+	return ParallelMap(DefaultPool(), begin, end, grain, std::move(function));
+}
+
+#endif //ADVENTOFCODE2021_PARALLEL_HPP
@@ -0,0 +1,137 @@
+#ifndef ADVENTOFCODE2021_SPLITVIEW_HPP
+#define ADVENTOFCODE2021_SPLITVIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+// Lazily splits a string into std::string_view tokens without allocating.
+// With a delimiter it behaves like repeated std::getline (empty tokens are kept,
+// a trailing delimiter does not produce an extra token); without one it behaves
+// like std::istream_iterator<std::string> and skips runs of whitespace.
+class SplitView
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::string_view *;
+		using reference = const std::string_view &;
+
+		Iterator() = default;
+
+		reference operator*() const
+		{
+			return _token;
+		}
+
+		pointer operator->() const
+		{
+			return &_token;
+		}
+
+		Iterator &operator++()
+		{
+			Advance();
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			auto copy = *this;
+			Advance();
+			return copy;
+		}
+
+		bool operator==(const Iterator &other) const
+		{
+			return _done == other._done && (_done || _token.data() == other._token.data());
+		}
+
+	private:
+		friend class SplitView;
+
+		Iterator(std::string_view str, char delimiter, bool whitespace)
+				: _rest(str), _delimiter(delimiter), _whitespace(whitespace), _done(false)
+		{
+			Advance();
+		}
+
+		static bool IsWhitespace(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+		}
+
+		void Advance()
+		{
+			if (_whitespace)
+			{
+				std::size_t start = 0;
+				while (start < _rest.size() && IsWhitespace(_rest[start]))
+				{
+					++start;
+				}
+				_rest.remove_prefix(start);
+			}
+
+			if (_rest.empty())
+			{
+				_done = true;
+				_token = {};
+				return;
+			}
+
+			std::size_t end = 0;
+			if (_whitespace)
+			{
+				while (end < _rest.size() && !IsWhitespace(_rest[end]))
+				{
+					++end;
+				}
+			}
+			else
+			{
+				end = std::min(_rest.find(_delimiter), _rest.size());
+			}
+
+			_token = _rest.substr(0, end);
+			_rest.remove_prefix(std::min(end + 1, _rest.size()));
+		}
+
+	private:
+		std::string_view _rest{};
+		std::string_view _token{};
+		char _delimiter{};
+		bool _whitespace = false;
+		bool _done = true;
+	};
+
+	SplitView(std::string_view str, char delimiter)
+			: _str(str), _delimiter(delimiter), _whitespace(false)
+	{}
+
+	explicit SplitView(std::string_view str)
+			: _str(str), _delimiter(' '), _whitespace(true)
+	{}
+
+	[[nodiscard]] Iterator begin() const
+	{
+		return {_str, _delimiter, _whitespace};
+	}
+
+	[[nodiscard]] Iterator end() const
+	{
+		return {};
+	}
+
+private:
+	std::string_view _str;
+	char _delimiter;
+	bool _whitespace;
+};
+
+#endif //ADVENTOFCODE2021_SPLITVIEW_HPP
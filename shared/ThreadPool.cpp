@@ -0,0 +1,279 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+	// Lets Submit find the queue of the calling worker.
+	thread_local const ThreadPool *currentPool = nullptr;
+	thread_local std::size_t currentIndex = 0;
+
+	std::mutex defaultPoolMutex;
+	std::size_t defaultPoolSize = 0;
+	std::unique_ptr<ThreadPool> defaultPool;
+
+	std::size_t EnvironmentPoolSize()
+	{
+		std::size_t threads = 0;
+		if (const auto *value = std::getenv("AOC_THREADS"); value != nullptr)
+		{
+			const std::string_view text{value};
+			const auto res = std::from_chars(text.data(), text.data() + text.size(), threads);
+			if (res.ec != std::errc() || res.ptr != text.data() + text.size())
+			{
+				throw std::runtime_error("Invalid AOC_THREADS");
+			}
+		}
+		return threads != 0 ? threads : std::thread::hardware_concurrency();
+	}
+}
+
+ThreadPool::ThreadPool(std::size_t threads)
+{
+	threads = std::max<std::size_t>(threads, 1);
+	for (auto i = 0U; i < threads; ++i)
+	{
+		_queues.push_back(std::make_unique<Queue>());
+	}
+	for (auto i = 0U; i < threads; ++i)
+	{
+		_threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(_mutex);
+		_stop = true;
+	}
+	_wake.notify_all();
+	for (auto &thread: _threads)
+	{
+		thread.join();
+	}
+}
+
+void ThreadPool::Submit(ThreadPool::Task task)
+{
+	const auto index = currentPool == this ? currentIndex : _next++ % _queues.size();
+
+	++_pending;
+	{
+		std::lock_guard lock(_queues[index]->mutex);
+		_queues[index]->tasks.push_back(std::move(task));
+	}
+	++_queued;
+
+	// Taking the lock orders the notification after a worker that is about to sleep has checked _queued.
+	{
+		std::lock_guard lock(_mutex);
+	}
+	_wake.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock lock(_mutex);
+	_idle.wait(lock, [this]
+	{
+		return _pending == 0;
+	});
+
+	if (_error)
+	{
+		std::rethrow_exception(std::exchange(_error, nullptr));
+	}
+}
+
+std::size_t ThreadPool::Size() const
+{
+	return _threads.size();
+}
+
+bool ThreadPool::RunPendingTask()
+{
+	Task task;
+	if (!TryPop(currentPool == this ? currentIndex : 0, task))
+	{
+		return false;
+	}
+	Execute(task);
+	return true;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index)
+{
+	currentPool = this;
+	currentIndex = index;
+
+	Task task;
+	while (true)
+	{
+		if (TryPop(index, task))
+		{
+			Execute(task);
+			continue;
+		}
+
+		std::unique_lock lock(_mutex);
+		_wake.wait(lock, [this]
+		{
+			return _stop || _queued > 0;
+		});
+		if (_stop && _queued <= 0)
+		{
+			return;
+		}
+	}
+}
+
+bool ThreadPool::TryPop(std::size_t index, ThreadPool::Task &task)
+{
+	{
+		auto &own = *_queues[index];
+		std::lock_guard lock(own.mutex);
+		if (!own.tasks.empty())
+		{
+			task = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			--_queued;
+			return true;
+		}
+	}
+
+	for (auto i = 1U; i < _queues.size(); ++i)
+	{
+		auto &victim = *_queues[(index + i) % _queues.size()];
+		std::lock_guard lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			--_queued;
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::Execute(ThreadPool::Task &task)
+{
+	try
+	{
+		task();
+	}
+	catch (...)
+	{
+		std::lock_guard lock(_mutex);
+		if (!_error)
+		{
+			_error = std::current_exception();
+		}
+	}
+	task = nullptr;
+
+	if (--_pending == 0)
+	{
+		std::lock_guard lock(_mutex);
+		_idle.notify_all();
+	}
+}
+
+TaskGroup::TaskGroup(ThreadPool &pool) : _pool(pool)
+{}
+
+TaskGroup::~TaskGroup()
+{
+	Join();
+}
+
+void TaskGroup::Run(ThreadPool::Task task)
+{
+	++_pending;
+	_pool.Submit([this, task = std::move(task)]() mutable
+	             {
+		             try
+		             {
+			             task();
+		             }
+		             catch (...)
+		             {
+			             std::lock_guard lock(_mutex);
+			             if (!_error)
+			             {
+				             _error = std::current_exception();
+			             }
+		             }
+		             // Released before the group may be destroyed by a joining thread.
+		             task = nullptr;
+
+		             std::lock_guard lock(_mutex);
+		             if (--_pending == 0)
+		             {
+			             _done.notify_all();
+		             }
+	             });
+}
+
+void TaskGroup::Wait()
+{
+	Join();
+
+	std::lock_guard lock(_mutex);
+	if (_error)
+	{
+		std::rethrow_exception(std::exchange(_error, nullptr));
+	}
+}
+
+void TaskGroup::Join()
+{
+	while (_pending > 0 && _pool.RunPendingTask())
+	{
+	}
+
+	// Whatever is left is already running on other threads. Blocking instead of spinning keeps the cores
+	// for them, and taking the lock keeps the group alive until the last task has released it.
+	std::unique_lock lock(_mutex);
+	_done.wait(lock, [this]
+	{
+		return _pending == 0;
+	});
+}
+
+ThreadPool &DefaultPool()
+{
+	std::lock_guard lock(defaultPoolMutex);
+	if (!defaultPool)
+	{
+		defaultPool = std::make_unique<ThreadPool>(defaultPoolSize != 0 ? defaultPoolSize : EnvironmentPoolSize());
+	}
+	return *defaultPool;
+}
+
+void SetDefaultPoolSize(std::size_t threads)
+{
+	threads = threads != 0 ? threads : EnvironmentPoolSize();
+
+	std::lock_guard lock(defaultPoolMutex);
+	if (defaultPool && defaultPool->Size() != std::max<std::size_t>(threads, 1))
+	{
+		throw std::runtime_error("Default thread pool is already running");
+	}
+	defaultPoolSize = threads;
+}
+
+std::size_t DefaultPoolSize()
+{
+	std::lock_guard lock(defaultPoolMutex);
+	if (defaultPool)
+	{
+		return defaultPool->Size();
+	}
+	return std::max<std::size_t>(defaultPoolSize != 0 ? defaultPoolSize : EnvironmentPoolSize(), 1);
+}
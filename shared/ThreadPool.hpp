@@ -0,0 +1,103 @@
+#ifndef ADVENTOFCODE2021_THREADPOOL_HPP
+#define ADVENTOFCODE2021_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Fixed size work-stealing pool. Every worker owns a deque: it pops its own tasks from the back and
+// steals from the front of the other workers' deques once it runs dry. Tasks submitted from inside a
+// worker go to that worker's deque, tasks submitted from outside are distributed round robin.
+class ThreadPool
+{
+public:
+	using Task = std::function<void()>;
+
+	explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool &) = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	void Submit(Task task);
+
+	// Blocks until every submitted task has finished and rethrows the first exception a task threw.
+	// Must not be called from inside a task.
+	void Wait();
+
+	[[nodiscard]] std::size_t Size() const;
+
+	// Runs one queued task on the calling thread, returns false if every deque was empty. Lets threads that
+	// wait for a TaskGroup keep the pool busy instead of blocking a worker.
+	bool RunPendingTask();
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void WorkerLoop(std::size_t index);
+	bool TryPop(std::size_t index, Task &task);
+	void Execute(Task &task);
+
+private:
+	std::vector<std::unique_ptr<Queue>> _queues;
+	std::vector<std::thread> _threads;
+
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	std::condition_variable _idle;
+	std::atomic<std::ptrdiff_t> _queued = 0;
+	std::atomic<std::size_t> _pending = 0;
+	std::atomic<std::size_t> _next = 0;
+	bool _stop = false;
+	std::exception_ptr _error;
+};
+
+// Fork/join scope on a pool: Run forks a task, Wait joins all of them and rethrows the first exception one
+// of them threw. The joining thread executes queued tasks until none are left, so groups may be nested
+// inside tasks of the same pool. The destructor joins as well, tasks never outlive the group.
+class TaskGroup
+{
+public:
+	explicit TaskGroup(ThreadPool &pool);
+	~TaskGroup();
+
+	TaskGroup(const TaskGroup &) = delete;
+	TaskGroup &operator=(const TaskGroup &) = delete;
+
+	void Run(ThreadPool::Task task);
+	void Wait();
+
+private:
+	void Join();
+
+private:
+	ThreadPool &_pool;
+	std::atomic<std::size_t> _pending = 0;
+	std::mutex _mutex;
+	std::condition_variable _done;
+	std::exception_ptr _error;
+};
+
+// Pool shared by the solvers for parallelism inside a day, created on first use. Its size is the value
+// passed to SetDefaultPoolSize, otherwise $AOC_THREADS, otherwise the number of hardware threads.
+[[nodiscard]] ThreadPool &DefaultPool();
+
+// Zero selects the default. Throws if the default pool already exists with a different size.
+void SetDefaultPoolSize(std::size_t threads);
+
+// Size of the default pool, or the size it will be created with. Does not create it.
+[[nodiscard]] std::size_t DefaultPoolSize();
+
+#endif //ADVENTOFCODE2021_THREADPOOL_HPP
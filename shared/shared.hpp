@@ -3,18 +3,26 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <stdexcept>
 #include <charconv>
+#include <array>
 
-[[nodiscard]] std::vector<std::string> LoadLines(const std::string &path);
+#include "InputFile.hpp"
+#include "IntegerList.hpp"
+#include "SplitView.hpp"
 
 template <class N>
 [[nodiscard]] N StrToInteger(std::string_view sv, int base = 10);
-[[nodiscard]] std::vector<std::uint16_t> LinesToUint16(const std::vector<std::string> &lines);
-[[nodiscard]] std::vector<std::pair<std::string, std::uint16_t>> LinesToStrUint16(const std::vector<std::string> &lines);
-[[nodiscard]] std::vector<std::string> SplitStringWhitespace(const std::string &str);
-[[nodiscard]] std::vector<std::string> SplitString(const std::string &str, char delimiter);
+[[nodiscard]] std::vector<std::pair<std::string, std::uint16_t>> LinesToStrUint16(const std::vector<std::string_view> &lines);
+
+template<std::size_t Count>
+[[nodiscard]] std::array<std::string_view, Count> SplitTokens(const SplitView &tokens);
+template<class N, std::size_t Count>
+[[nodiscard]] std::array<N, Count> ParseIntegers(const SplitView &tokens, int base = 10);
+template<class N>
+void AppendIntegers(const SplitView &tokens, std::vector<N> &output, int base = 10);
 
 template<class N>
 N StrToInteger(std::string_view sv, int base)
@@ -29,4 +37,53 @@ N StrToInteger(std::string_view sv, int base)
 	return value;
 }
 
+template<std::size_t Count>
+std::array<std::string_view, Count> SplitTokens(const SplitView &tokens)
+{
+	std::array<std::string_view, Count> result{};
+	std::size_t count = 0;
+	for (const auto token: tokens)
+	{
+		if (count == Count)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		result[count++] = token;
+	}
+	if (count != Count)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	return result;
+}
+
+template<class N, std::size_t Count>
+std::array<N, Count> ParseIntegers(const SplitView &tokens, int base)
+{
+	std::array<N, Count> result{};
+	std::size_t count = 0;
+	for (const auto token: tokens)
+	{
+		if (count == Count)
+		{
+			throw std::runtime_error("Failed to parse input");
+		}
+		result[count++] = StrToInteger<N>(token, base);
+	}
+	if (count != Count)
+	{
+		throw std::runtime_error("Failed to parse input");
+	}
+	return result;
+}
+
+template<class N>
+void AppendIntegers(const SplitView &tokens, std::vector<N> &output, int base)
+{
+	for (const auto token: tokens)
+	{
+		output.push_back(StrToInteger<N>(token, base));
+	}
+}
+
 #endif //ADVENTOFCODE2021_SHARED_HPP